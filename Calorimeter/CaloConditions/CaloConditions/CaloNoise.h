@@ -1,6 +1,6 @@
 //Dear emacs, this is -*-c++-*-
 /*
-  Copyright (C) 2002-2018 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2024 CERN for the benefit of the ATLAS collaboration
 */
 
 #ifndef CALOCONDITIONS_CALONOISE_H
@@ -53,8 +53,7 @@ class CaloNoise {
 
 
 
-  float getEffectiveSigma(const Identifier id, const int gain, const float energy) const {
-    IdentifierHash h=m_caloCellId->calo_cell_hash(id);
+  float getEffectiveSigma(const IdentifierHash h, const int gain, const float energy) const {
     if (h<m_tileHashOffset) {
       return m_larNoise[gain][h];
     }
@@ -63,6 +62,11 @@ class CaloNoise {
     }
   }
 
+  float getEffectiveSigma(const Identifier id, const int gain, const float energy) const {
+    IdentifierHash h=m_caloCellId->calo_cell_hash(id);
+    return getEffectiveSigma(h,gain,energy);
+  }
+
   /// Non-const accessor to underlying storage for filling:
   boost::multi_array<float, 2>& larStorage() {return m_larNoise;}
   boost::multi_array<float, 2>& tileStorage() {return m_tileNoise;}
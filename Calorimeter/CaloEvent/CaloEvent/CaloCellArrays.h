@@ -0,0 +1,82 @@
+// This file's extension implies that it's C, but it's really -*- C++ -*-.
+/*
+  Copyright (C) 2002-2024 CERN for the benefit of the ATLAS collaboration
+*/
+/**
+ * @file CaloEvent/CaloCellArrays.h
+ * @brief Cell quantities of a CaloCellContainer in arrays indexed by calo hash.
+ */
+#ifndef CALOEVENT_CALOCELLARRAYS_H
+#define CALOEVENT_CALOCELLARRAYS_H
+
+
+#include "CaloIdentifier/CaloGain.h"
+#include "Identifier/IdentifierHash.h"
+#include <vector>
+#include <cstdint>
+
+
+class CaloCellContainer;
+
+
+/**
+ * @brief Energy, time, quality, provenance and gain of the cells of one
+ *        CaloCellContainer, stored in contiguous arrays indexed by calo hash.
+ *
+ * Clients that look up many cells by hash (tower building, moments, ...)
+ * can read these arrays instead of going through the polymorphic
+ * @c CaloCell objects.  Hashes without a cell in the container have
+ * @c index() < 0 and zero content.  The arrays are a snapshot: they
+ * are only valid for the container they were built from, which can
+ * be checked with @c container().
+ */
+class CaloCellArrays
+{
+public:
+  /**
+   * @brief Fill the arrays from a cell container.
+   * @param cells The container to copy.
+   * @param hashMax Number of calo cell hashes (@c CaloCell_ID::calo_cell_hash_max()).
+   */
+  CaloCellArrays (const CaloCellContainer& cells, unsigned int hashMax);
+
+  /// The container the arrays were built from.
+  const CaloCellContainer* container() const { return m_container; }
+
+  /// Number of hashes covered.
+  size_t size() const { return m_index.size(); }
+
+  /// Index of the cell in the container, or -1 if it is not present.
+  int index (IdentifierHash hash) const { return m_index[hash]; }
+
+  float energy (IdentifierHash hash) const { return m_energy[hash]; }
+  float time (IdentifierHash hash) const { return m_time[hash]; }
+  uint16_t quality (IdentifierHash hash) const { return m_quality[hash]; }
+  uint16_t provenance (IdentifierHash hash) const { return m_provenance[hash]; }
+  CaloGain::CaloGain gain (IdentifierHash hash) const { return m_gain[hash]; }
+
+  /// Direct access to the arrays.
+  const std::vector<int>& indices() const { return m_index; }
+  const std::vector<float>& energies() const { return m_energy; }
+  const std::vector<float>& times() const { return m_time; }
+  const std::vector<uint16_t>& qualities() const { return m_quality; }
+  const std::vector<uint16_t>& provenances() const { return m_provenance; }
+  const std::vector<CaloGain::CaloGain>& gains() const { return m_gain; }
+
+
+private:
+  const CaloCellContainer* m_container;
+  std::vector<int> m_index;
+  std::vector<float> m_energy;
+  std::vector<float> m_time;
+  std::vector<uint16_t> m_quality;
+  std::vector<uint16_t> m_provenance;
+  std::vector<CaloGain::CaloGain> m_gain;
+};
+
+
+#include "AthenaKernel/CLASS_DEF.h"
+CLASS_DEF(CaloCellArrays, 118265311, 1)
+
+
+#endif // not CALOEVENT_CALOCELLARRAYS_H
@@ -0,0 +1,102 @@
+// This file's extension implies that it's C, but it's really -*- C++ -*-.
+/*
+  Copyright (C) 2002-2024 CERN for the benefit of the ATLAS collaboration
+*/
+/**
+ * @file CaloEvent/CaloCellSignificance.h
+ * @brief Noise and signal significance of the cells of a CaloCellContainer,
+ *        indexed by calo hash.
+ */
+#ifndef CALOEVENT_CALOCELLSIGNIFICANCE_H
+#define CALOEVENT_CALOCELLSIGNIFICANCE_H
+
+
+#include "Identifier/IdentifierHash.h"
+#include <vector>
+
+
+class CaloCellContainer;
+class CaloNoise;
+
+
+/**
+ * @brief Per-event noise sigma and E/sigma of every cell of one
+ *        CaloCellContainer, in contiguous arrays indexed by calo hash.
+ *
+ * The noise is evaluated once per cell for the cell's gain, using the
+ * double-Gaussian effective sigma for Tile if requested.  Clients that
+ * apply significance cuts (topo-clustering, ...) can read the arrays
+ * instead of querying @c CaloNoise again for each cell.  Hashes without
+ * a cell in the container have zero sigma and significance.  The sigma
+ * is stored as returned by @c CaloNoise, so it may be zero or not finite;
+ * the significance is zero in that case.  The arrays are only valid for
+ * the container they were built from (see @c container()), for the
+ * noise conditions object they were evaluated with (see @c noise()) and
+ * for the noise settings given by @c twoGaussianNoise().
+ */
+class CaloCellSignificance
+{
+public:
+  /**
+   * @brief Fill the arrays from a cell container.
+   * @param cells The cells to evaluate.
+   * @param noise The noise conditions object.
+   * @param twoGaussianNoise Use the Tile double-Gaussian effective sigma.
+   * @param hashMax Number of calo cell hashes (@c CaloCell_ID::calo_cell_hash_max()).
+   */
+  CaloCellSignificance (const CaloCellContainer& cells,
+                        const CaloNoise& noise,
+                        bool twoGaussianNoise,
+                        unsigned int hashMax);
+
+  /// The container the arrays were built from.
+  const CaloCellContainer* container() const { return m_container; }
+
+  /// The noise conditions object the arrays were evaluated with.
+  const CaloNoise* noise() const { return m_noise; }
+
+  /// True if the Tile double-Gaussian effective sigma was used.
+  bool twoGaussianNoise() const { return m_twoGaussianNoise; }
+
+  /**
+   * @brief Test if the arrays can be used in place of @c CaloNoise.
+   * @param cells The cells to be evaluated.
+   * @param noise The noise conditions object to be used.
+   * @param twoGaussianNoise The Tile double-Gaussian setting to be used.
+   */
+  bool matches (const CaloCellContainer* cells,
+                const CaloNoise* noise,
+                bool twoGaussianNoise) const
+  {
+    return m_container == cells && m_noise == noise &&
+      m_twoGaussianNoise == twoGaussianNoise;
+  }
+
+  /// Number of hashes covered.
+  size_t size() const { return m_noiseSigma.size(); }
+
+  /// Noise sigma of the cell for its gain.
+  float noiseSigma (IdentifierHash hash) const { return m_noiseSigma[hash]; }
+
+  /// Cell energy over noise sigma.
+  float significance (IdentifierHash hash) const { return m_significance[hash]; }
+
+  /// Direct access to the arrays.
+  const std::vector<float>& noiseSigmas() const { return m_noiseSigma; }
+  const std::vector<float>& significances() const { return m_significance; }
+
+
+private:
+  const CaloCellContainer* m_container;
+  const CaloNoise* m_noise;
+  bool m_twoGaussianNoise;
+  std::vector<float> m_noiseSigma;
+  std::vector<float> m_significance;
+};
+
+
+#include "AthenaKernel/CLASS_DEF.h"
+CLASS_DEF(CaloCellSignificance, 219887461, 1)
+
+
+#endif // not CALOEVENT_CALOCELLSIGNIFICANCE_H
@@ -0,0 +1,37 @@
+/*
+  Copyright (C) 2002-2024 CERN for the benefit of the ATLAS collaboration
+*/
+/**
+ * @file CaloEvent/src/CaloCellArrays.cxx
+ * @brief Cell quantities of a CaloCellContainer in arrays indexed by calo hash.
+ */
+
+
+#include "CaloEvent/CaloCellArrays.h"
+#include "CaloEvent/CaloCellContainer.h"
+#include "CaloEvent/CaloCell.h"
+
+
+CaloCellArrays::CaloCellArrays (const CaloCellContainer& cells,
+                                unsigned int hashMax)
+  : m_container (&cells),
+    m_index (hashMax, -1),
+    m_energy (hashMax, 0),
+    m_time (hashMax, 0),
+    m_quality (hashMax, 0),
+    m_provenance (hashMax, 0),
+    m_gain (hashMax, CaloGain::INVALIDGAIN)
+{
+  const int ncells = cells.size();
+  for (int i = 0; i < ncells; ++i) {
+    const CaloCell* cell = cells[i];
+    const IdentifierHash hash = cell->caloDDE()->calo_hash();
+    if (hash >= hashMax) continue;
+    m_index[hash] = i;
+    m_energy[hash] = cell->energy();
+    m_time[hash] = cell->time();
+    m_quality[hash] = cell->quality();
+    m_provenance[hash] = cell->provenance();
+    m_gain[hash] = cell->gain();
+  }
+}
@@ -0,0 +1,40 @@
+/*
+  Copyright (C) 2002-2024 CERN for the benefit of the ATLAS collaboration
+*/
+/**
+ * @file CaloEvent/src/CaloCellSignificance.cxx
+ * @brief Noise and signal significance of the cells of a CaloCellContainer,
+ *        indexed by calo hash.
+ */
+
+
+#include "CaloEvent/CaloCellSignificance.h"
+#include "CaloEvent/CaloCellContainer.h"
+#include "CaloEvent/CaloCell.h"
+#include "CaloConditions/CaloNoise.h"
+#include <cmath>
+
+
+CaloCellSignificance::CaloCellSignificance (const CaloCellContainer& cells,
+                                            const CaloNoise& noise,
+                                            bool twoGaussianNoise,
+                                            unsigned int hashMax)
+  : m_container (&cells),
+    m_noise (&noise),
+    m_twoGaussianNoise (twoGaussianNoise),
+    m_noiseSigma (hashMax, 0),
+    m_significance (hashMax, 0)
+{
+  for (const CaloCell* cell : cells) {
+    const IdentifierHash hash = cell->caloDDE()->calo_hash();
+    if (hash >= hashMax) continue;
+    const float energy = cell->energy();
+    const float sigma = twoGaussianNoise ?
+      noise.getEffectiveSigma (hash, cell->gain(), energy) :
+      noise.getNoise (hash, cell->gain());
+    m_noiseSigma[hash] = sigma;
+    if (std::isfinite (sigma) && sigma > 0) {
+      m_significance[hash] = energy / sigma;
+    }
+  }
+}
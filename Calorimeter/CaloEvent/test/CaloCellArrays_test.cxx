@@ -0,0 +1,118 @@
+/*
+  Copyright (C) 2002-2024 CERN for the benefit of the ATLAS collaboration
+*/
+/**
+ * @file CaloEvent/test/CaloCellArrays_test.cxx
+ * @brief Unit test for CaloCellArrays.
+ */
+
+
+#undef NDEBUG
+#include "CaloEvent/CaloCellArrays.h"
+#include "CaloEvent/CaloCellContainer.h"
+#include "CaloEvent/CaloCell.h"
+#include "CaloEvent/CaloTester.h"
+#include "StoreGate/setupStoreGate.h"
+#include "TestTools/random.h"
+#include <algorithm>
+#include <iostream>
+#include <vector>
+#include <cassert>
+
+
+// A partial container, in random order, with varied cell contents.
+std::unique_ptr<CaloCellContainer>
+make_partial (CaloTester& tester, Athena_test::URNG& stlrand)
+{
+  std::vector<CaloCell*> all_cells = tester.get_cells();
+  std::vector<CaloCell*> selected;
+  for (size_t i = 0; i < all_cells.size(); i += 3) {
+    CaloCell* cell = all_cells[i];
+    cell->setEnergy (0.5 * i - 1000);
+    cell->setTime (0.01 * i);
+    cell->setQuality (static_cast<uint16_t> (i % 65536));
+    cell->setProvenance (static_cast<uint16_t> ((7 * i) % 65536));
+    cell->setGain (static_cast<CaloGain::CaloGain> (i % 3));
+    selected.push_back (cell);
+  }
+  std::shuffle (selected.begin(), selected.end(), stlrand);
+
+  auto cells = std::make_unique<CaloCellContainer> (SG::VIEW_ELEMENTS);
+  for (CaloCell* cell : selected) {
+    cells->push_back (cell);
+  }
+  return cells;
+}
+
+
+// Fill and hash -> index lookup.
+void test1 (CaloTester& tester, Athena_test::URNG& stlrand)
+{
+  std::cout << "test1\n";
+  const unsigned int hashMax = tester.caloID().calo_cell_hash_max();
+  std::unique_ptr<CaloCellContainer> cells = make_partial (tester, stlrand);
+
+  CaloCellArrays arrays (*cells, hashMax);
+  assert (arrays.container() == cells.get());
+  assert (arrays.size() == hashMax);
+  assert (arrays.indices().size() == hashMax);
+  assert (arrays.energies().size() == hashMax);
+  assert (arrays.times().size() == hashMax);
+  assert (arrays.qualities().size() == hashMax);
+  assert (arrays.provenances().size() == hashMax);
+  assert (arrays.gains().size() == hashMax);
+
+  size_t nfound = 0;
+  for (unsigned int hash = 0; hash < hashMax; ++hash) {
+    // same lookup as the container
+    const int index = arrays.index (hash);
+    assert (index == cells->findIndex (hash));
+    if (index >= 0) {
+      const CaloCell* cell = (*cells)[index];
+      assert (cell->caloDDE()->calo_hash() == hash);
+      assert (arrays.energy (hash) == cell->energy());
+      assert (arrays.time (hash) == cell->time());
+      assert (arrays.quality (hash) == cell->quality());
+      assert (arrays.provenance (hash) == cell->provenance());
+      assert (arrays.gain (hash) == cell->gain());
+      ++nfound;
+    }
+    else {
+      assert (hash % 3 != 0);
+      assert (arrays.energy (hash) == 0);
+      assert (arrays.time (hash) == 0);
+      assert (arrays.quality (hash) == 0);
+      assert (arrays.provenance (hash) == 0);
+      assert (arrays.gain (hash) == CaloGain::INVALIDGAIN);
+    }
+  }
+  assert (nfound == cells->size());
+
+  // complete container
+  std::unique_ptr<CaloCellContainer> ccc = tester.make_ccc();
+  CaloCellArrays arrays2 (*ccc, hashMax);
+  for (unsigned int hash = 0; hash < hashMax; ++hash) {
+    assert (arrays2.index (hash) == ccc->findIndex (hash));
+    assert (arrays2.index (hash) >= 0);
+  }
+
+  // empty container
+  CaloCellContainer empty (SG::VIEW_ELEMENTS);
+  CaloCellArrays arrays3 (empty, hashMax);
+  assert (arrays3.size() == hashMax);
+  for (unsigned int hash = 0; hash < hashMax; hash += 97) {
+    assert (arrays3.index (hash) == -1);
+  }
+}
+
+
+int main (int /*argc*/, char** argv)
+{
+  std::cout << "CaloEvent/CaloCellArrays_test\n";
+  Athena_test::setupStoreGate (argv[0]);
+  CaloTester tester;
+  assert( tester.record_mgr().isSuccess() );
+  Athena_test::URNG stlrand;
+  test1 (tester, stlrand);
+  return 0;
+}
@@ -0,0 +1,216 @@
+/*
+  Copyright (C) 2002-2024 CERN for the benefit of the ATLAS collaboration
+*/
+/**
+ * @file CaloEvent/test/CaloCellSignificance_test.cxx
+ * @brief Unit test for CaloCellSignificance.
+ */
+
+
+#undef NDEBUG
+#include "CaloEvent/CaloCellSignificance.h"
+#include "CaloEvent/CaloCellContainer.h"
+#include "CaloEvent/CaloCell.h"
+#include "CaloEvent/CaloTester.h"
+#include "CaloConditions/CaloNoise.h"
+#include "CaloCondBlobObjs/CaloCondBlobFlt.h"
+#include "CoralBase/Blob.h"
+#include "StoreGate/setupStoreGate.h"
+#include <iostream>
+#include <memory>
+#include <vector>
+#include <cmath>
+#include <cassert>
+
+
+void test1 (CaloTester& tester)
+{
+  std::cout << "test1\n";
+  const CaloCell_ID& caloID = tester.caloID();
+  const unsigned int hashMax = caloID.calo_cell_hash_max();
+
+  IdentifierHash tileMin, tileMax;
+  caloID.calo_cell_hash_range (CaloCell_ID::TILE, tileMin, tileMax);
+  CaloNoise noise (tileMin, 3, hashMax - tileMin, 4, &caloID, CaloNoise::TOTAL);
+  boost::multi_array<float, 2>& lar = noise.larStorage();
+  for (unsigned int gain = 0; gain < 3; ++gain) {
+    for (unsigned int h = 0; h < tileMin; ++h) {
+      lar[gain][h] = 10 + h % 7 + 100 * gain;
+    }
+  }
+  // a cell without noise information
+  const IdentifierHash noNoiseHash = 42;
+  lar[CaloGain::LARHIGHGAIN][noNoiseHash] = 0;
+
+  // a few LAr cells with different energies and gains
+  std::vector<std::unique_ptr<CaloCell> > owned;
+  CaloCellContainer cells (SG::VIEW_ELEMENTS);
+  const std::vector<unsigned int> hashes { 0, 5, noNoiseHash, 1000, tileMin - 1 };
+  for (unsigned int i = 0; i < hashes.size(); ++i) {
+    owned.push_back (tester.make_cell (hashes[i]));
+    owned.back()->setEnergy (50. * (i + 1) - 120.);
+    if (i == 3) owned.back()->setGain (CaloGain::LARMEDIUMGAIN);
+    cells.push_back (owned.back().get());
+  }
+
+  for (bool twoGaussian : { false, true }) {
+    CaloCellSignificance sig (cells, noise, twoGaussian, hashMax);
+    assert (sig.container() == &cells);
+    assert (sig.noise() == &noise);
+    assert (sig.twoGaussianNoise() == twoGaussian);
+    assert (sig.size() == hashMax);
+    assert (sig.noiseSigmas().size() == hashMax);
+    assert (sig.significances().size() == hashMax);
+
+    for (const CaloCell* cell : cells) {
+      const IdentifierHash hash = cell->caloDDE()->calo_hash();
+      const float sigma = noise.getNoise (hash, cell->gain());
+      assert (sig.noiseSigma (hash) == sigma);
+      if (sigma > 0) {
+        assert (std::abs (sig.significance (hash) - cell->energy() / sigma) < 1e-6);
+      }
+      else {
+        assert (sig.significance (hash) == 0);
+      }
+    }
+    assert (sig.noiseSigma (noNoiseHash) == 0);
+    assert (sig.significance (noNoiseHash) == 0);
+
+    // hashes without a cell in the container are zero
+    assert (sig.noiseSigma (1) == 0);
+    assert (sig.significance (1) == 0);
+    assert (sig.noiseSigma (hashMax - 1) == 0);
+  }
+}
+
+
+// Tile cells, with the double-Gaussian effective sigma.
+void test2 (CaloTester& tester)
+{
+  std::cout << "test2\n";
+  const CaloCell_ID& caloID = tester.caloID();
+  const unsigned int hashMax = caloID.calo_cell_hash_max();
+
+  IdentifierHash tileMin, tileMax;
+  caloID.calo_cell_hash_range (CaloCell_ID::TILE, tileMin, tileMax);
+  const unsigned int nTile = hashMax - tileMin;
+
+  // The blob must outlive the noise object, which owns the CaloCondBlobFlt.
+  coral::Blob blob;
+  CaloNoise noise (tileMin, 3, nTile, 4, &caloID, CaloNoise::TOTAL);
+  boost::multi_array<float, 2>& tile = noise.tileStorage();
+  for (unsigned int gain = 0; gain < 4; ++gain) {
+    for (unsigned int h = 0; h < nTile; ++h) {
+      tile[gain][h] = 30 + h % 5 + 50 * gain;
+    }
+  }
+
+  // Per gain: a, b, sigma1, sigma2, ratio of the two Gaussians.
+  CaloCondBlobFlt::DefType def;
+  for (unsigned int gain = 0; gain < 4; ++gain) {
+    def.push_back ({ 20.f + 5 * gain, 1.5f, 20.f + 5 * gain, 60.f + 10 * gain, 0.1f });
+  }
+  CaloCondBlobFlt* flt = CaloCondBlobFlt::getInstance (blob);
+  flt->init (def, nTile, 1);
+  noise.setTileBlob (flt, 2);
+
+  std::vector<std::unique_ptr<CaloCell> > owned;
+  CaloCellContainer cells (SG::VIEW_ELEMENTS);
+  const std::vector<unsigned int> hashes { tileMin, tileMin + 7, tileMin + 100, hashMax - 1 };
+  const std::vector<CaloGain::CaloGain> gains { CaloGain::TILEONELOW,
+                                                CaloGain::TILEONEHIGH,
+                                                CaloGain::TILEHIGHLOW,
+                                                CaloGain::TILEHIGHHIGH };
+  const std::vector<float> energies { 100, -80, 0, 400 };
+  for (unsigned int i = 0; i < hashes.size(); ++i) {
+    owned.push_back (tester.make_cell (hashes[i]));
+    owned.back()->setEnergy (energies[i]);
+    owned.back()->setGain (gains[i]);
+    cells.push_back (owned.back().get());
+  }
+
+  CaloCellSignificance sig1 (cells, noise, false, hashMax);
+  CaloCellSignificance sig2 (cells, noise, true, hashMax);
+  size_t ndiff = 0;
+  for (const CaloCell* cell : cells) {
+    const IdentifierHash hash = cell->caloDDE()->calo_hash();
+    const float sigma1 = noise.getNoise (hash, cell->gain());
+    const float sigma2 = noise.getEffectiveSigma (hash, cell->gain(), cell->energy());
+    assert (sigma1 > 0);
+    assert (sigma2 > 0);
+    assert (sig1.noiseSigma (hash) == sigma1);
+    assert (sig2.noiseSigma (hash) == sigma2);
+    assert (std::abs (sig1.significance (hash) - cell->energy() / sigma1) < 1e-6);
+    assert (std::abs (sig2.significance (hash) - cell->energy() / sigma2) < 1e-6);
+    if (sigma1 != sigma2) ++ndiff;
+  }
+  // The two settings give different sigmas, so neither may stand in for the other.
+  assert (ndiff > 0);
+  assert (sig1.matches (&cells, &noise, false));
+  assert (!sig1.matches (&cells, &noise, true));
+  assert (sig2.matches (&cells, &noise, true));
+  assert (!sig2.matches (&cells, &noise, false));
+}
+
+
+// The arrays may only be used for the container and noise they were made from.
+void test3 (CaloTester& tester)
+{
+  std::cout << "test3\n";
+  const CaloCell_ID& caloID = tester.caloID();
+  const unsigned int hashMax = caloID.calo_cell_hash_max();
+
+  IdentifierHash tileMin, tileMax;
+  caloID.calo_cell_hash_range (CaloCell_ID::TILE, tileMin, tileMax);
+  CaloNoise noise1 (tileMin, 3, hashMax - tileMin, 4, &caloID, CaloNoise::TOTAL);
+  CaloNoise noise2 (tileMin, 3, hashMax - tileMin, 4, &caloID, CaloNoise::TOTAL);
+  for (unsigned int gain = 0; gain < 3; ++gain) {
+    for (unsigned int h = 0; h < tileMin; ++h) {
+      noise1.larStorage()[gain][h] = 10 + h % 7;
+      noise2.larStorage()[gain][h] = 20 + h % 7;
+    }
+  }
+
+  // The same cells, with other energies, in a second container.
+  std::vector<std::unique_ptr<CaloCell> > owned1, owned2;
+  CaloCellContainer cells1 (SG::VIEW_ELEMENTS);
+  CaloCellContainer cells2 (SG::VIEW_ELEMENTS);
+  const std::vector<unsigned int> hashes { 3, 17, 500 };
+  for (unsigned int hash : hashes) {
+    owned1.push_back (tester.make_cell (hash));
+    owned1.back()->setEnergy (100);
+    cells1.push_back (owned1.back().get());
+    owned2.push_back (tester.make_cell (hash));
+    owned2.back()->setEnergy (-300);
+    cells2.push_back (owned2.back().get());
+  }
+
+  CaloCellSignificance sig (cells1, noise1, false, hashMax);
+  assert (sig.matches (&cells1, &noise1, false));
+  assert (!sig.matches (&cells2, &noise1, false));
+  assert (!sig.matches (&cells1, &noise2, false));
+  assert (!sig.matches (&cells1, &noise1, true));
+  assert (!sig.matches (&cells2, &noise2, false));
+
+  // ... and would give wrong values for the others.
+  for (size_t i = 0; i < hashes.size(); ++i) {
+    const CaloCell* cell2 = cells2[i];
+    const IdentifierHash hash = hashes[i];
+    assert (sig.noiseSigma (hash) != noise2.getNoise (hash, cell2->gain()));
+    assert (sig.significance (hash) !=
+            cell2->energy() / noise1.getNoise (hash, cell2->gain()));
+  }
+}
+
+
+int main (int /*argc*/, char** argv)
+{
+  std::cout << "CaloEvent/CaloCellSignificance_test\n";
+  Athena_test::setupStoreGate (argv[0]);
+  CaloTester tester;
+  assert( tester.record_mgr().isSuccess() );
+  test1 (tester);
+  test2 (tester);
+  test3 (tester);
+  return 0;
+}
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2019 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2024 CERN for the benefit of the ATLAS collaboration
 */
 
 /********************************************************************
@@ -22,6 +22,7 @@ PURPOSE:  Apply necessary finalising operation to CaloCellContainer
 #include "GaudiKernel/ListItem.h"
 
 #include "StoreGate/StoreGateSvc.h"
+#include "StoreGate/WriteHandle.h"
 
 
 #include "CaloEvent/CaloCellContainer.h"
@@ -59,6 +60,7 @@ StatusCode CaloCellContainerFinalizerTool::initialize()
 {
 
   ATH_CHECK(detStore()->retrieve(m_theCaloCCIDM,"CaloCell_ID"));
+  ATH_CHECK(m_cellArraysKey.initialize(SG::AllowEmpty));
   return StatusCode::SUCCESS;
 }
 
@@ -143,21 +145,39 @@ StatusCode CaloCellContainerFinalizerTool::doProcess(CONTAINER* theCont ) const
 }
 
 
+StatusCode
+CaloCellContainerFinalizerTool::recordArrays (const CaloCellContainer& theCont,
+                                              const EventContext& ctx) const
+{
+  SG::WriteHandle<CaloCellArrays> arrays (m_cellArraysKey, ctx);
+  ATH_CHECK( arrays.record (std::make_unique<CaloCellArrays>
+                            (theCont, m_theCaloCCIDM->calo_cell_hash_max())) );
+  return StatusCode::SUCCESS;
+}
+
+
 StatusCode
 CaloCellContainerFinalizerTool::process (CaloCellContainer * theCont,
-                                         const EventContext& /*ctx*/) const
+                                         const EventContext& ctx) const
 {
   CHECK( doProcess (theCont) );
+  if (!m_cellArraysKey.empty()) {
+    CHECK( recordArrays (*theCont, ctx) );
+  }
   return StatusCode::SUCCESS;
 }
 
 
 StatusCode
 CaloCellContainerFinalizerTool::process (CaloConstCellContainer * theCont,
-                                         const EventContext& /*ctx*/) const
+                                         const EventContext& ctx) const
 {
   // Container will automatically be locked when recorded.
-  return doProcess (theCont);
+  CHECK( doProcess (theCont) );
+  if (!m_cellArraysKey.empty()) {
+    CHECK( recordArrays (*theCont->asDataVector(), ctx) );
+  }
+  return StatusCode::SUCCESS;
 }
 
 
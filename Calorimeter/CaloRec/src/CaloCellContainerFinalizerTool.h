@@ -1,7 +1,7 @@
 // This file's extension implies that it's C, but it's really -*- C++ -*-.
 
 /*
-  Copyright (C) 2002-2019 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2024 CERN for the benefit of the ATLAS collaboration
 */
 
 
@@ -12,6 +12,8 @@
 
 #include "CaloInterface/ICaloCellMakerTool.h"
 #include "CaloInterface/ICaloConstCellMakerTool.h"
+#include "CaloEvent/CaloCellArrays.h"
+#include "StoreGate/WriteHandleKey.h"
 
 class CaloCell_ID;
 
@@ -36,7 +38,14 @@ private:
   template <class CONTAINER>
   StatusCode doProcess (CONTAINER* theCellContainer) const;
 
+  StatusCode recordArrays (const CaloCellContainer& theCellContainer,
+                           const EventContext& ctx) const;
+
   const CaloCell_ID* m_theCaloCCIDM;
+
+  /// Optional hash-indexed copy of the finalized cells, for clients that look up many cells by hash
+  SG::WriteHandleKey<CaloCellArrays> m_cellArraysKey
+  { this, "CellArraysKey", "", "If set, record CaloCellArrays for the finalized container with this key" };
 };
 
 #endif
@@ -0,0 +1,44 @@
+/*
+ * Copyright (C) 2002-2024 CERN for the benefit of the ATLAS collaboration.
+ */
+/**
+ * @file CaloRec/src/CaloCellSignificanceAlg.cxx
+ * @brief Record the noise and significance of all cells of a cell container.
+ */
+
+
+#include "CaloCellSignificanceAlg.h"
+#include "CaloIdentifier/CaloCell_ID.h"
+#include "StoreGate/ReadHandle.h"
+#include "StoreGate/ReadCondHandle.h"
+#include "StoreGate/WriteHandle.h"
+
+
+/**
+ * @brief Gaudi initialize method.
+ */
+StatusCode CaloCellSignificanceAlg::initialize()
+{
+  ATH_CHECK( m_cellsKey.initialize() );
+  ATH_CHECK( m_noiseCDOKey.initialize() );
+  ATH_CHECK( m_significanceKey.initialize() );
+  ATH_CHECK( detStore()->retrieve (m_calo_id, "CaloCell_ID") );
+  return StatusCode::SUCCESS;
+}
+
+
+/**
+ * @brief Execute the algorithm.
+ * @param ctx Current event context.
+ */
+StatusCode CaloCellSignificanceAlg::execute (const EventContext& ctx) const
+{
+  SG::ReadHandle<CaloCellContainer> cells (m_cellsKey, ctx);
+  SG::ReadCondHandle<CaloNoise> noise (m_noiseCDOKey, ctx);
+
+  SG::WriteHandle<CaloCellSignificance> significance (m_significanceKey, ctx);
+  ATH_CHECK( significance.record (std::make_unique<CaloCellSignificance>
+                                  (*cells, **noise, m_twoGaussianNoise,
+                                   m_calo_id->calo_cell_hash_max())) );
+  return StatusCode::SUCCESS;
+}
@@ -0,0 +1,71 @@
+// This file's extension implies that it's C, but it's really -*- C++ -*-.
+/*
+ * Copyright (C) 2002-2024 CERN for the benefit of the ATLAS collaboration.
+ */
+/**
+ * @file CaloRec/src/CaloCellSignificanceAlg.h
+ * @brief Record the noise and significance of all cells of a cell container.
+ */
+
+
+#ifndef CALOREC_CALOCELLSIGNIFICANCEALG_H
+#define CALOREC_CALOCELLSIGNIFICANCEALG_H
+
+
+#include "AthenaBaseComps/AthReentrantAlgorithm.h"
+#include "CaloEvent/CaloCellContainer.h"
+#include "CaloEvent/CaloCellSignificance.h"
+#include "CaloConditions/CaloNoise.h"
+#include "StoreGate/ReadHandleKey.h"
+#include "StoreGate/ReadCondHandleKey.h"
+#include "StoreGate/WriteHandleKey.h"
+#include "Gaudi/Property.h"
+
+
+class CaloCell_ID;
+
+
+/**
+ * @brief Record the noise and significance of all cells of a cell container.
+ *
+ * Evaluates the noise of each cell once per event and records it as a
+ * @c CaloCellSignificance, so that downstream algorithms using the same
+ * noise settings do not have to query @c CaloNoise again for each cell.
+ */
+class CaloCellSignificanceAlg : public AthReentrantAlgorithm
+{
+public:
+  using AthReentrantAlgorithm::AthReentrantAlgorithm;
+
+
+  /**
+   * @brief Gaudi initialize method.
+   */
+  virtual StatusCode initialize() override;
+
+
+  /**
+   * @brief Execute the algorithm.
+   * @param ctx Current event context.
+   */
+  virtual StatusCode execute(const EventContext& ctx) const override;
+
+
+private:
+  SG::ReadHandleKey<CaloCellContainer> m_cellsKey
+  { this, "Cells", "AllCalo", "Cell container to evaluate" };
+
+  SG::ReadCondHandleKey<CaloNoise> m_noiseCDOKey
+  { this, "CaloNoiseKey", "totalNoise", "SG Key of CaloNoise data object" };
+
+  SG::WriteHandleKey<CaloCellSignificance> m_significanceKey
+  { this, "CellSignificance", "AllCaloSignificance", "Output cell significance object" };
+
+  Gaudi::Property<bool> m_twoGaussianNoise
+  { this, "TwoGaussianNoise", false, "Use the double-Gaussian effective sigma for Tile" };
+
+  const CaloCell_ID* m_calo_id = nullptr;
+};
+
+
+#endif // not CALOREC_CALOCELLSIGNIFICANCEALG_H
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2024 CERN for the benefit of the ATLAS collaboration
 */
 
 //-----------------------------------------------------------------------
@@ -385,8 +385,8 @@ CaloClusterMomentsMaker::execute(const EventContext& ctx,
         CxxUtils::prefetchNext(cellIter, cellIterEnd);
         const CaloCell* pCell = *cellIter;
 
-	Identifier myId = pCell->ID();
-	IdentifierHash myHashId = m_calo_id->calo_cell_hash(myId); 
+	const CaloDetDescrElement* myCDDE = pCell->caloDDE();
+	IdentifierHash myHashId = myCDDE ? myCDDE->calo_hash() : m_calo_id->calo_cell_hash(pCell->ID());
 	if ( clusterIdx[(unsigned int)myHashId].first != noCluster) {
 	  // check weight and assign to current cluster if weight is > 0.5
 	  double weight = cellIter.weight();
@@ -453,8 +453,9 @@ CaloClusterMomentsMaker::execute(const EventContext& ctx,
         CaloPrefetch::nextDDE(cellIter, cellIterEnd);
 
         const CaloCell* pCell = (*cellIter);
-	Identifier myId = pCell->ID();
 	const CaloDetDescrElement* myCDDE = pCell->caloDDE();
+	// the calo hash is needed for noise, isolation and the cell info: get it once per cell
+	const IdentifierHash myHashId = myCDDE ? myCDDE->calo_hash() : m_calo_id->calo_cell_hash(pCell->ID());
 	double ene = pCell->e();
         if(m_absOpt) ene = std::abs(ene);  
 	double weight = cellIter.weight();//theCluster->getCellWeight(cellIter);
@@ -495,8 +496,8 @@ CaloClusterMomentsMaker::execute(const EventContext& ctx,
       
 	if ( m_calculateSignificance ) {
 	  const float sigma = m_twoGaussianNoise ?\
-	    noise->getEffectiveSigma(pCell->ID(),pCell->gain(),pCell->energy()) : \
-	    noise->getNoise(pCell->ID(),pCell->gain());
+	    noise->getEffectiveSigma(myHashId,pCell->gain(),pCell->energy()) : \
+	    noise->getNoise(myHashId,pCell->gain());
 
 	  sumSig2 += sigma*sigma;
 	  // use geomtery weighted energy of cell for leading cell significance
@@ -522,7 +523,6 @@ CaloClusterMomentsMaker::execute(const EventContext& ctx,
 	  // get all 2D Neighbours if the cell is not inside another cluster with
 	  // larger weight
 
-	  IdentifierHash myHashId = m_calo_id->calo_cell_hash(myId);
 	  if ( clusterIdx[myHashId].first == iClus ) {
             theNeighbors.clear();
 	    m_calo_id->get_neighbours(myHashId, LArNeighbours::all2D, theNeighbors);
@@ -563,7 +563,7 @@ CaloClusterMomentsMaker::execute(const EventContext& ctx,
 	    ci.energy     = ene*weight;
 	    ci.volume     = myCDDE->volume();
 	    ci.sample     = myCDDE->getSampling();
-	    ci.identifier = m_calo_id->calo_cell_hash(myId);
+	    ci.identifier = myHashId;
 
 	    if ( ci.energy > maxSampE[(unsigned int)ci.sample] )
 	      maxSampE[(unsigned int)ci.sample] = ci.energy;
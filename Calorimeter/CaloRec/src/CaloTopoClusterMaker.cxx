@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2024 CERN for the benefit of the ATLAS collaboration
 */
 
 //-----------------------------------------------------------------------
@@ -292,6 +292,7 @@ StatusCode CaloTopoClusterMaker::initialize()
   //---- retrieve the noise CDO  ----------------
   
   ATH_CHECK(m_noiseCDOKey.initialize());
+  ATH_CHECK(m_cellSignificanceKey.initialize(SG::AllowEmpty));
 
   ATH_MSG_INFO( (m_seedCutsInAbsE?"ClusterAbsEtCut= ":"ClusterEtCut= ")
                 << m_clusterEtorAbsEtCut << " MeV"  );
@@ -360,6 +361,20 @@ CaloTopoClusterMaker::execute(const EventContext& ctx,
 
   const DataLink<CaloCellContainer> cellCollLink (cellColl.name(),ctx);
 
+  // use the precomputed cell noise if it was made for these cells with the same noise
+  const CaloCellSignificance* cellSignificance = nullptr;
+  if (!m_cellSignificanceKey.empty()) {
+    SG::ReadHandle<CaloCellSignificance> significanceHdl(m_cellSignificanceKey, ctx);
+    if (significanceHdl.isValid()
+        && significanceHdl->matches(cellColl.cptr(), noiseCDO, m_twogaussiannoise)) {
+      cellSignificance = significanceHdl.cptr();
+    }
+    else {
+      ATH_MSG_DEBUG("CaloCellSignificance " << m_cellSignificanceKey.key()
+                    << " not usable for " << cellColl.name() << ", using CaloNoise");
+    }
+  }
+
   //ATH_MSG_DEBUG("CaloCell container: "<< cellsName 
   //		  <<" contains " << cellColl->size() << " cells");
 
@@ -374,9 +389,12 @@ CaloTopoClusterMaker::execute(const EventContext& ctx,
         {
           CaloPrefetch::nextDDE(cellIter, cellIterEnd, 2);
 	  const CaloCell* pCell = *cellIter;
-	  const float noiseSigma = m_twogaussiannoise ? \
-	    noiseCDO->getEffectiveSigma(pCell->ID(),pCell->gain(),pCell->energy()) : \
-	    noiseCDO->getNoise(pCell->ID(),pCell->gain());
+	  const CaloDetDescrElement* dde = pCell->caloDDE();
+	  IdentifierHash hashid = dde ? dde->calo_hash() : m_calo_id->calo_cell_hash(pCell->ID());
+	  const float noiseSigma = cellSignificance ? cellSignificance->noiseSigma(hashid) : \
+	    m_twogaussiannoise ? \
+	    noiseCDO->getEffectiveSigma(hashid,pCell->gain(),pCell->energy()) : \
+	    noiseCDO->getNoise(hashid,pCell->gain());
 
 	  float signedE = pCell->energy();
 	  float signedEt = pCell->et();
@@ -399,8 +417,6 @@ CaloTopoClusterMaker::execute(const EventContext& ctx,
 	  if(m_cutOOTseed && passedSeedCut && !passTimeCut_seedCell) passedCellAndTimeCut=false; //exclude Out-Of-Time seeds from cluster (if required)
 
 	  if ( passedCellAndTimeCut || passedNeighborAndTimeCut || passedSeedAndTimeCut ) {
-	    const CaloDetDescrElement* dde = pCell->caloDDE();
-	    IdentifierHash hashid = dde ? dde->calo_hash() : m_calo_id->calo_cell_hash(pCell->ID());
 	    CaloTopoTmpClusterCell *tmpClusterCell =
               new (tmpcell_pool.allocate())
               CaloTopoTmpClusterCell(hashid,subdet,iCell,signedRatio,signedEt);
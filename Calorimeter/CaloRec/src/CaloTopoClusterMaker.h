@@ -1,6 +1,6 @@
 //Dear emacs, this is -*-c++-*-
 /*
-  Copyright (C) 2002-2020 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2024 CERN for the benefit of the ATLAS collaboration
 */
 
 #ifndef CALOTOPOCLUSTERMAKER_H
@@ -38,6 +38,7 @@
 #include "CaloUtils/CaloClusterCollectionProcessor.h"
 #include "LArCabling/LArOnOffIdMapping.h"
 #include "CaloConditions/CaloNoise.h"
+#include "CaloEvent/CaloCellSignificance.h"
 #include "StoreGate/ReadCondHandleKey.h"
 
 class Identifier; 
@@ -140,6 +141,11 @@ private:
 
   SG::ReadCondHandleKey<CaloNoise> m_noiseCDOKey{this,"CaloNoiseKey","totalNoise","SG Key of CaloNoise data object"};
 
+  /** @brief Optional per-event cell noise and significance, filled with the same
+   *  noise settings (see CaloCellSignificanceAlg).  If it was built from the cell
+   *  container being clustered, the noise is read from it instead of CaloNoise. */
+  SG::ReadHandleKey<CaloCellSignificance> m_cellSignificanceKey{this,"CellSignificanceKey","","SG Key of CaloCellSignificance object (optional)"};
+
 
   //SG::ReadCondHandleKey<LArOnOffIdMapping> m_cablingKey{this,"CablingKey","LArOnOffIdMap","SG Key of LArOnOffIdMapping object"};
 
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2024 CERN for the benefit of the ATLAS collaboration
 */
 
 
@@ -29,6 +29,7 @@
 
 #include "CaloTopoTowerBuilderTool.h"
 
+#include <array>
 #include <string>
 #include <cmath>
 
@@ -108,10 +109,16 @@ StatusCode CaloTopoTowerBuilderTool::execute(const EventContext& ctx,
   ATH_MSG_DEBUG("Noise cuts "<< noiseSigma0 << " " <<  cellESignificanceThreshold);
 
   // List of calorimeters from which to use cells
-  std::vector<CaloCell_ID::SUBCALO> caloIndices = theTowers->GetCaloIndices();
+  const std::vector<CaloCell_ID::SUBCALO> caloIndices = theTowers->GetCaloIndices();
   bool caloSelection = theTowers->GetCaloSelection();
 
   ATH_MSG_DEBUG("caloSelection " << caloSelection << " " << caloIndices.size());
+
+  // the same selection as a lookup table, consulted for every cell of every tower
+  std::array<bool,CaloCell_ID::NSUBCALO> useCalo{};
+  for (CaloCell_ID::SUBCALO iCalo : caloIndices) {
+    if (static_cast<unsigned int>(iCalo) < CaloCell_ID::NSUBCALO) useCalo[iCalo] = true;
+  }
   
   //Finished loading variables from CaloTopoTowerContainer 
   //////////////////////////////////////////////////////////////////////////////
@@ -201,9 +208,7 @@ StatusCode CaloTopoTowerBuilderTool::execute(const EventContext& ctx,
 	
 	if (caloSelection) {
 	  CaloCell_ID::SUBCALO iCaloNum = (cell->caloDDE()->getSubCalo());           // keep only cells from desired calorimeter
-	  std::vector<CaloCell_ID::SUBCALO>::const_iterator theFound =
-	    find (caloIndices.begin(),caloIndices.end(),iCaloNum);
-	  if (theFound==caloIndices.end()) continue ;
+	  if (static_cast<unsigned int>(iCaloNum) >= CaloCell_ID::NSUBCALO || !useCalo[iCaloNum]) continue ;
 	}
 	
 	signedE             = cell->e();                             // get the cell energy if we got a good pointer
@@ -33,6 +33,7 @@
 #include "../CaloThinCellsByClusterAlg.h"
 #include "../CaloThinCellsBySamplingAlg.h"
 #include "../CaloCellContainerAliasAlg.h"
+#include "../CaloCellSignificanceAlg.h"
 #include "../ToolConstantsCondAlg.h"
 #include "../CaloNoiseSigmaDiffCondAlg.h"
 #include "../CaloCellWeightCorrection.h"
@@ -88,6 +89,7 @@ DECLARE_COMPONENT (CaloCellDumper)
 DECLARE_COMPONENT (CaloThinCellsByClusterAlg)
 DECLARE_COMPONENT (CaloThinCellsBySamplingAlg)
 DECLARE_COMPONENT (CaloCellContainerAliasAlg)
+DECLARE_COMPONENT (CaloCellSignificanceAlg)
 DECLARE_COMPONENT (ToolConstantsCondAlg)
 DECLARE_COMPONENT (CaloNoiseSigmaDiffCondAlg)
 
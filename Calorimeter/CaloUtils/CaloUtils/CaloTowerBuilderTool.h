@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2021 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2024 CERN for the benefit of the ATLAS collaboration
 */
 
 #ifndef CALOREC_CALOTOWERBUILDERTOOL_H
@@ -18,6 +18,8 @@
 
 #include "CaloUtils/CaloTowerBuilderToolBase.h"
 #include "CaloUtils/CaloTowerStore.h"
+#include "CaloEvent/CaloCellArrays.h"
+#include "StoreGate/ReadHandleKey.h"
 
 
 
@@ -97,6 +99,10 @@ private:
 
   std::vector<std::string> m_includedCalos;
 
+  /// Optional hash-indexed cell arrays, used instead of the cells when built from the same container
+  SG::ReadHandleKey<CaloCellArrays> m_cellArraysKey
+  { this, "CellArraysKey", "", "CaloCellArrays recorded for the input cell container, if any" };
+
   ////////////////////////
   // Store and Services //
   ////////////////////////
@@ -114,11 +120,14 @@ private:
   virtual StatusCode checkSetup(MsgStream& log);
   static void addTower (const CaloTowerStore::tower_iterator tower_it,
                  const ElementLink<CaloCellContainer>& cellsEL,
+                 const CaloCellArrays* arrays,
                  CaloTower* tower) ;
   void iterateFull (CaloTowerContainer* towers,
-                    const ElementLink<CaloCellContainer>& cellsEL) const;
+                    const ElementLink<CaloCellContainer>& cellsEL,
+                    const CaloCellArrays* arrays) const;
   void iterateSubSeg (CaloTowerContainer* towers,
                       const ElementLink<CaloCellContainer>& cellsEL,
+                      const CaloCellArrays* arrays,
                       const CaloTowerSeg::SubSeg* subseg) const;
 
 
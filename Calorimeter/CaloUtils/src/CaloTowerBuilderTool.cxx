@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2024 CERN for the benefit of the ATLAS collaboration
 */
 
 
@@ -21,6 +21,7 @@
 #include "CaloEvent/CaloTowerContainer.h"
 #include "CaloUtils/CaloTowerStore.h"
 #include "CaloUtils/CaloTowerBuilderTool.h"
+#include "StoreGate/ReadHandle.h"
 
 #include <string>
 #include <cmath>
@@ -51,6 +52,7 @@ CaloTowerBuilderTool::~CaloTowerBuilderTool()
 // protected!
 StatusCode CaloTowerBuilderTool::initializeTool() {
   m_caloIndices = parseCalos (m_includedCalos);
+  ATH_CHECK( m_cellArraysKey.initialize (SG::AllowEmpty) );
   return this->checkSetup(msg());
 }
 
@@ -63,6 +65,7 @@ inline
 void
 CaloTowerBuilderTool::addTower (const CaloTowerStore::tower_iterator tower_it,
                                 const ElementLink<CaloCellContainer>& cellsEL,
+                                const CaloCellArrays* arrays,
                                 CaloTower* tower) 
 {
   CaloTowerStore::cell_iterator firstC = tower_it.firstCell();
@@ -74,6 +77,15 @@ CaloTowerBuilderTool::addTower (const CaloTowerStore::tower_iterator tower_it,
 
     unsigned int ci = firstC.hash();
     double weightC = firstC.weight();
+    if (arrays) {
+      // same cells, read from the contiguous hash-indexed arrays
+      int cndx = arrays->index(ci);
+      if (cndx >= 0) {
+        wsumE += weightC * arrays->energy(ci);
+        tower->addUniqueCellNoKine(cellsEL, cndx, weightC, ts);
+      }
+      continue;
+    }
     int cndx = cells->findIndex(ci);
     const CaloCell* cellPtr = nullptr;
     if (cndx >= 0)
@@ -96,7 +108,8 @@ CaloTowerBuilderTool::addTower (const CaloTowerStore::tower_iterator tower_it,
 inline
 void
 CaloTowerBuilderTool::iterateFull (CaloTowerContainer* towers,
-                                   const ElementLink<CaloCellContainer>& cellsEL) const
+                                   const ElementLink<CaloCellContainer>& cellsEL,
+                                   const CaloCellArrays* arrays) const
 {
   size_t sz = towers->size();
   assert(m_cellStore.size() ==  sz);
@@ -104,7 +117,7 @@ CaloTowerBuilderTool::iterateFull (CaloTowerContainer* towers,
 
   for (unsigned int t = 0; t < sz; ++t, ++tower_it) {
     CaloTower* aTower = towers->getTower(t);
-    addTower (tower_it, cellsEL, aTower);
+    addTower (tower_it, cellsEL, arrays, aTower);
   }
 }
 
@@ -113,6 +126,7 @@ inline
 void
 CaloTowerBuilderTool::iterateSubSeg (CaloTowerContainer* towers,
                                      const ElementLink<CaloCellContainer>& cellsEL,
+                                     const CaloCellArrays* arrays,
                                      const CaloTowerSeg::SubSeg* subseg) const
 {
   size_t sz = towers->size();
@@ -122,7 +136,7 @@ CaloTowerBuilderTool::iterateSubSeg (CaloTowerContainer* towers,
 #if 0
   for (unsigned int t = 0; t < sz; ++t, ++tower_it) {
     CaloTower* aTower = towers->getTower(tower_it.itower());
-    addTower (tower_it, cellsEL, aTower);
+    addTower (tower_it, cellsEL, arrays, aTower);
   }
 #endif
   // This loop was originally written as above.  However, if we increment
@@ -133,7 +147,7 @@ CaloTowerBuilderTool::iterateSubSeg (CaloTowerContainer* towers,
   unsigned int t = 0;
   while (true) {
     CaloTower* aTower = towers->getTower(tower_it.itower());
-    addTower (tower_it, cellsEL, aTower);
+    addTower (tower_it, cellsEL, arrays, aTower);
     ++t;
     if (t >= sz) break;
     ++tower_it;
@@ -188,11 +202,20 @@ CaloTowerBuilderTool::execute(const EventContext& ctx,
     }
   }
 
+  // Hash-indexed cell arrays, only if they were made from this container
+  const CaloCellArrays* arrays = nullptr;
+  if (!m_cellArraysKey.empty()) {
+    SG::ReadHandle<CaloCellArrays> arraysHandle (m_cellArraysKey, ctx);
+    if (arraysHandle.isValid() && arraysHandle->container() == theCells) {
+      arrays = arraysHandle.cptr();
+    }
+  }
+
   const ElementLink<CaloCellContainer> cellsEL (*theCells, 0, ctx);
   if (subseg)
-    iterateSubSeg (theTowers, cellsEL, subseg);
+    iterateSubSeg (theTowers, cellsEL, arrays, subseg);
   else
-    iterateFull (theTowers, cellsEL);
+    iterateFull (theTowers, cellsEL, arrays);
 
   for (unsigned int i = 0; i < m_caloIndices.size(); i++) {
     theTowers->setCalo(m_caloIndices[i]);
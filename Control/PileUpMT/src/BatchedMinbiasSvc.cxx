@@ -1,12 +1,11 @@
 /*
-  Copyright (C) 2022 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2022-2024 CERN for the benefit of the ATLAS collaboration
 */
 
 #include "BatchedMinbiasSvc.h"
 
 #include <algorithm>
 #include <chrono>
-#include <thread>
 
 #include <fmt/chrono.h>
 #include <fmt/format.h>
@@ -37,7 +36,9 @@ BatchedMinbiasSvc::BatchedMinbiasSvc(const std::string& name, ISvcLocator* svc)
       m_empty_caches_mtx(),
       m_batch_use_count(),
       m_last_loaded_batch(),
-      m_last_unloaded_batch() {}
+      m_last_unloaded_batch(),
+      m_wait_mtx(),
+      m_wait_cv() {}
 
 BatchedMinbiasSvc::~BatchedMinbiasSvc() {}
 
@@ -45,6 +46,13 @@ int BatchedMinbiasSvc::event_to_batch(std::uint64_t hs_id) {
     return int(hs_id / m_HSBatchSize.value());
 }
 
+void BatchedMinbiasSvc::notify_waiters() {
+    // Taking the mutex orders the state change before the wake-up,
+    // so a waiter cannot miss it between checking and sleeping
+    { std::lock_guard lg{m_wait_mtx}; }
+    m_wait_cv.notify_all();
+}
+
 StatusCode BatchedMinbiasSvc::initialize() {
     m_idx_list.resize(m_MBBatchSize.value(), 0);
     std::iota(m_idx_list.begin(), m_idx_list.end(), 0);
@@ -149,8 +157,9 @@ StatusCode BatchedMinbiasSvc::beginHardScatter(std::uint64_t hs_id) {
         if (m_last_loaded_batch < (batch - 1)) {
             ATH_MSG_VERBOSE("Waiting to prevent out-of-order loading of batches");
         }
-        while (m_last_loaded_batch < (batch - 1)) {
-            std::this_thread::sleep_for(50ms);
+        {
+            std::unique_lock lk{m_wait_mtx};
+            m_wait_cv.wait(lk, [&] { return m_last_loaded_batch >= (batch - 1); });
         }
         // See if there are any free caches
         // Using try_lock here to avoid reading same batch twice
@@ -221,14 +230,16 @@ StatusCode BatchedMinbiasSvc::beginHardScatter(std::uint64_t hs_id) {
                 }
                 m_empty_caches_mtx.unlock();
                 m_last_loaded_batch.exchange(batch);
+                notify_waiters();
                 return StatusCode::SUCCESS;
             }
                              // Unlock mutex if we got the lock but all caches were empty
                 m_empty_caches_mtx.unlock();
 
         }
-        // Wait  100ms then try again
-        std::this_thread::sleep_for(100ms);
+        // Wait until a batch is loaded or a cache is freed (at most 100ms), then try again
+        std::unique_lock lk{m_wait_mtx};
+        m_wait_cv.wait_for(lk, 100ms);
     }
     return StatusCode::SUCCESS;
 }
@@ -240,7 +251,6 @@ StoreGateSvc* BatchedMinbiasSvc::getMinbias(std::uint64_t hs_id, std::uint64_t m
 }
 
 StatusCode BatchedMinbiasSvc::endHardScatter(std::uint64_t hs_id) {
-    using namespace std::chrono_literals;
     int batch = event_to_batch(hs_id);
     int uses = m_batch_use_count[batch]->fetch_add(1) + 1;
 
@@ -256,12 +266,16 @@ StatusCode BatchedMinbiasSvc::endHardScatter(std::uint64_t hs_id) {
             ATH_CHECK(sg->clearStore());
             //    }
         }
-        while (m_last_unloaded_batch < (batch - 1)) {
-            std::this_thread::sleep_for(50ms);
+        {
+            std::unique_lock lk{m_wait_mtx};
+            m_wait_cv.wait(lk, [&] { return m_last_unloaded_batch >= (batch - 1); });
+        }
+        {
+            std::lock_guard lg{m_empty_caches_mtx};
+            m_empty_caches.emplace_back(std::move(temp));
+            m_last_unloaded_batch.store(batch);
         }
-        std::lock_guard lg{m_empty_caches_mtx};
-        m_empty_caches.emplace_back(std::move(temp));
-        m_last_unloaded_batch.store(batch);
+        notify_waiters();
     }
     else {
         ATH_MSG_VERBOSE("BATCH " << batch << ": " << uses << " uses out of "
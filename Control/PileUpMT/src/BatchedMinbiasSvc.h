@@ -1,6 +1,6 @@
 /* -*- C++ -*- */
 /*
-  Copyright (C) 2022 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2022-2024 CERN for the benefit of the ATLAS collaboration
 */
 
 #ifndef TESTCODE_LOWPTMINBIASSVC
@@ -15,6 +15,7 @@
 #include "StoreGate/StoreGateSvc.h"
 
 #include <atomic>
+#include <condition_variable>
 #include <deque>
 #include <map>
 #include <memory>
@@ -72,7 +73,11 @@ class BatchedMinbiasSvc : public extends<AthService, IMinbiasSvc> {
     std::vector<std::unique_ptr<std::atomic_int>> m_batch_use_count;
     std::atomic_int m_last_loaded_batch;
     std::atomic_int m_last_unloaded_batch;
+    // wakes up threads waiting for a batch to be loaded or a cache to be freed
+    std::mutex m_wait_mtx;
+    std::condition_variable m_wait_cv;
     int event_to_batch(std::uint64_t hs_id);
+    void notify_waiters();
 };
 
 #endif // TESTCODE_LOWPTMINBIASSVC
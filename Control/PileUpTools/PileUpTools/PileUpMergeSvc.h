@@ -1,7 +1,7 @@
 /* -*- C++ -*- */
 
 /*
-  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2024 CERN for the benefit of the ATLAS collaboration
 */
 
 /** @file PileUpMergeSvc.h
@@ -175,6 +175,10 @@ private:
   typedef std::map<std::pair<CLID, std::string>, Range> RangeContainer;
   RangeContainer m_ranges;
 
+  /// the active crossing range for a CLID/key (no limits if not configured).
+  /// Look it up once and test each sub-event with Range::contains.
+  const Range& liveRange(CLID id, const std::string& dataKey);
+
   ToolHandle<ITriggerTime> m_pITriggerTime; ///< allows to apply a trigger time offset
   ///< controls PileUpTimedEventIndex for TimedData returned by retrieveSubEvts
   BooleanProperty m_returnTimedData; 
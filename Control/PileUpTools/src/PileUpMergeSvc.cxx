@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2024 CERN for the benefit of the ATLAS collaboration
 */
 
 #include "PileUpTools/PileUpMergeSvc.h"
@@ -277,7 +277,12 @@ PileUpMergeSvc::queryInterface(const InterfaceID& riid, void** ppvInterface)
 
 bool
 PileUpMergeSvc::isLive(CLID id, const string& dataKey, int iXing) {
-  return m_ranges[make_pair(id, dataKey)].contains(iXing);
+  return liveRange(id, dataKey).contains(iXing);
+}
+
+const PileUpMergeSvc::Range&
+PileUpMergeSvc::liveRange(CLID id, const string& dataKey) {
+  return m_ranges[make_pair(id, dataKey)];
 }
 
 bool
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2024 CERN for the benefit of the ATLAS collaboration
 */
 
 ///////////////////////////////////////////////////////////////////
@@ -15,6 +15,7 @@
 // Data members classes
 #include "CLHEP/Geometry/Point3D.h"
 #include "GeneratorObjects/HepMcParticleLink.h"
+#include "HitManagement/TimedHitSortKey.h"
 
 class SiHit final {
 
@@ -200,4 +201,12 @@ inline float hitTime(const SiHit& hit)
   return (float) hit.meanTime();
 }
 
+/// SiHit::operator< orders hits by identify()
+template <>
+struct TimedHitSortKey<SiHit> {
+  static constexpr bool available = true;
+  typedef unsigned int key_type;
+  static key_type key(const SiHit& hit) { return hit.identify(); }
+};
+
 #endif // INDETSIMEVENT_SIHIT_H
@@ -1,11 +1,12 @@
 /*
-  Copyright (C) 2002-2017 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2024 CERN for the benefit of the ATLAS collaboration
 */
 
 #ifndef INDETSIMEVENT_TRTUncompressedHit_h
 #define INDETSIMEVENT_TRTUncompressedHit_h
 
 #include "GeneratorObjects/HepMcParticleLink.h"
+#include "HitManagement/TimedHitSortKey.h"
 
 class TRTUncompressedHit final
 {
@@ -113,4 +114,12 @@ inline float hitTime(const TRTUncompressedHit& hit)
   return (float) hit.GetGlobalTime();
 }
 
+/// TRTUncompressedHit::operator< orders hits by GetHitID()
+template <>
+struct TimedHitSortKey<TRTUncompressedHit> {
+  static constexpr bool available = true;
+  typedef int key_type;
+  static key_type key(const TRTUncompressedHit& hit) { return hit.GetHitID(); }
+};
+
 #endif // INDETSIMEVENT_TRTUncompressedHit_h
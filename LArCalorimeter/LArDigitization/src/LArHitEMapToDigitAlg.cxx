@@ -1,5 +1,5 @@
 /*
- *   Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration
+ *   Copyright (C) 2002-2024 CERN for the benefit of the ATLAS collaboration
  */
 #include "LArHitEMapToDigitAlg.h"
 #include "AthenaKernel/ITriggerTime.h"
@@ -218,6 +218,9 @@ StatusCode LArHitEMapToDigitAlg::MakeDigit(const EventContext& ctx, const Identi
   SG::ReadCondHandle<ILArPedestal> pedHdl(m_pedestalKey, ctx);
   const ILArPedestal* pedestal=*pedHdl;
 
+  SG::ReadCondHandle<ILArShape> shapeHdl(m_shapeKey, ctx);
+  const ILArShape* shape=*shapeHdl;
+
   const ILArNoise* noise=nullptr;  
   if ( (!m_RndmEvtOverlay || m_isMcOverlay)  && !m_pedestalNoise && m_NoiseOnOff ){
     SG::ReadCondHandle<ILArNoise> noiseHdl(m_noiseKey, ctx);
@@ -283,9 +286,9 @@ StatusCode LArHitEMapToDigitAlg::MakeDigit(const EventContext& ctx, const Identi
 
 
   if (!isDead) {
-    if( this->ConvertHits2Samples(ctx, cellId,ch_id,initialGain,TimeE, Samples).isFailure() ) return StatusCode::SUCCESS;
+    if( this->ConvertHits2Samples(shape, cellId,ch_id,initialGain,TimeE, Samples).isFailure() ) return StatusCode::SUCCESS;
     if(m_doDigiTruth){
-      if( this->ConvertHits2Samples(ctx, cellId,ch_id,initialGain,TimeE_DigiHSTruth, Samples_DigiHSTruth).isFailure() ) return StatusCode::SUCCESS;
+      if( this->ConvertHits2Samples(shape, cellId,ch_id,initialGain,TimeE_DigiHSTruth, Samples_DigiHSTruth).isFailure() ) return StatusCode::SUCCESS;
     }
   }
 
@@ -601,7 +604,7 @@ StatusCode LArHitEMapToDigitAlg::MakeDigit(const EventContext& ctx, const Identi
 
 // ----------------------------------------------------------------------------------------------------------------------------------
 
-StatusCode LArHitEMapToDigitAlg::ConvertHits2Samples(const EventContext& ctx,
+StatusCode LArHitEMapToDigitAlg::ConvertHits2Samples(const ILArShape* shape,
                                                      const Identifier & cellId, const HWIdentifier ch_id, CaloGain::CaloGain igain,
                                                      const std::vector<std::pair<float,float> >  *TimeE, staticVecDouble_t &sampleList) const
 
@@ -612,11 +615,6 @@ StatusCode LArHitEMapToDigitAlg::ConvertHits2Samples(const EventContext& ctx,
    int nsamples_der ;
    int i ;
    int j ;
-   float energy ;
-   float time ;
-
-   SG::ReadCondHandle<ILArShape> shapeHdl(m_shapeKey, ctx);
-   const ILArShape* shape=*shapeHdl;
 
 
 // ........ retrieve data (1/2) ................................
@@ -638,17 +636,6 @@ StatusCode LArHitEMapToDigitAlg::ConvertHits2Samples(const EventContext& ctx,
   {
        ATH_MSG_DEBUG(Shape[i] << " ");
   }
-#endif
-
-  std::vector<std::pair<float,float> >::const_iterator first = TimeE->begin();
-  std::vector<std::pair<float,float> >::const_iterator last  = TimeE->end();
-
-  while (first != last)
-  {
-   energy = (*first).first;
-   time   = (*first).second;
-
-#ifndef NDEBUG
   ATH_MSG_DEBUG("m_NSamples, m_usePhase " << m_NSamples << " " << m_usePhase);
 #endif
 
@@ -657,35 +644,53 @@ StatusCode LArHitEMapToDigitAlg::ConvertHits2Samples(const EventContext& ctx,
    //   but this should still be done in case of MC overlay
    int ihecshift=0;
    if((!m_RndmEvtOverlay || m_isMcOverlay) && m_larem_id->is_lar_hec(cellId) && m_NSamples.value() == 4 && m_firstSample.value() == 0) ihecshift=1;
+   const int offset = m_firstSample + ihecshift;
 
 
    if (!m_usePhase) {
 
  // Atlas like mode where we use 25ns binned pulse shape and derivative to deal with time offsets
-
+ // The hits are accumulated one by one, in their order, so that the samples do not depend
+ // on the summation order. A hit can only contribute if 0 <= i-ishift+offset < nsamples
+ // for some sample 0 <= i < m_NSamples. For ishift < offset-nsamples+1 every j is
+ // >= nsamples, for ishift > offset+m_NSamples-1 every j is < 0: the sample loop would
+ // add nothing, so these hits are skipped before it without changing the result.
+
+      const int minShift = offset - nsamples + 1;
+      const int maxShift = offset + m_NSamples.value() - 1;
+
+      for (const std::pair<float,float>& hit : *TimeE) {
+        const float energy = hit.first;
+        const float time   = hit.second;
 // shift between reference shape and this time
-      int ishift=(int)(rint(time*(1./25.)));
-      double dtime=time-25.*((double)(ishift));
-      for (i=0;i<m_NSamples.value();i++)
-      {
-       j = i - ishift + m_firstSample + ihecshift;
+        const int ishift=(int)(rint(time*(1./25.)));
+        if (ishift < minShift || ishift > maxShift) continue;
+        const double dtime=time-25.*((double)(ishift));
+        for (i=0;i<m_NSamples.value();i++)
+        {
+         j = i - ishift + offset;
 #ifndef NDEBUG
-       ATH_MSG_DEBUG(" time/i/j " << time << " "<< i << " " << j);
+         ATH_MSG_DEBUG(" time/i/j " << time << " "<< i << " " << j);
 #endif
-       if (j >=0 && j < nsamples ) {
-         if (j<nsamples_der && std::abs(ShapeDer[j])<10. )
-              sampleList[i] += (Shape[j]- ShapeDer[j]*dtime)*energy ;
-         else sampleList[i] += Shape[j]*energy ;
-       }
-      }
+         if (j >=0 && j < nsamples ) {
+           if (j<nsamples_der && std::abs(ShapeDer[j])<10. )
+                sampleList[i] += (Shape[j]- ShapeDer[j]*dtime)*energy ;
+           else sampleList[i] += Shape[j]*energy ;
+         }
+        }
+      }         // loop over hits
    }
 // Mode to use phase (tbin) to get pulse shape ( pulse shape with fine time binning should be available)
 
    else {
 
      // FIXME hardcode 8phases3ns configuration (cannot access parameters from ILArShape interface now)
-     int nTimeBins = 8;
-     float timeBinWidth = 25./24.*3.;
+     const int nTimeBins = 8;
+     const float timeBinWidth = 25./24.*3.;
+
+     for (const std::pair<float,float>& hit : *TimeE) {
+      const float energy = hit.first;
+      const float time   = hit.second;
 
 //    -50<t<-25 phase=-t-25, shift by one peak time (for s2 uses shape(3) with tbin)
 // for -25<t<0  phase = -t, no shift of peak time
@@ -716,7 +721,7 @@ StatusCode LArHitEMapToDigitAlg::ConvertHits2Samples(const EventContext& ctx,
 
       for (i=0;i<m_NSamples.value();i++)
       {
-       j = i - ishift+m_firstSample + ihecshift;
+       j = i - ishift + offset;
 #ifndef NDEBUG
        ATH_MSG_DEBUG(" time/i/j " << time << " "<< i << " " << j);
 #endif
@@ -726,12 +731,10 @@ StatusCode LArHitEMapToDigitAlg::ConvertHits2Samples(const EventContext& ctx,
          else sampleList[i] += Shape[j]*energy ;
        }
       }
+     }         // loop over hits
 
    }     // else if of m_usePhase
 
-   ++first;
-  }         // loop over hits
-
    return StatusCode::SUCCESS;
 
 }
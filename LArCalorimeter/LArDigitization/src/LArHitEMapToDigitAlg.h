@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2024 CERN for the benefit of the ATLAS collaboration
 */
 
 #ifndef LARDIGITIZATION_LARHITEMPATTODIGITALG_H
@@ -81,7 +81,7 @@ protected:
                const std::vector<std::pair<float,float> >* TimeE_DigiHSTruth = nullptr) const;
   
   
-  StatusCode ConvertHits2Samples(const EventContext& ctx, const Identifier & cellId, HWIdentifier ch_id,
+  StatusCode ConvertHits2Samples(const ILArShape* shape, const Identifier & cellId, HWIdentifier ch_id,
                    CaloGain::CaloGain igain,
                    const std::vector<std::pair<float,float> >  *TimeE,  staticVecDouble_t& sampleList) const;
 
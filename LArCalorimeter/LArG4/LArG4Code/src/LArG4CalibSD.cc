@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2024 CERN for the benefit of the ATLAS collaboration
 */
 
 #include "LArG4Code/LArG4CalibSD.h"
@@ -88,59 +88,30 @@ G4bool LArG4CalibSD::SimpleHit( const LArG4Identifier& a_ident , const std::vect
     return true;
   }
       
-  // Build the hit.
-  CaloCalibrationHit* hit = new CaloCalibrationHit(id,
-                                                   energies[0],
-                                                   energies[1],
-                                                   energies[2],
-                                                   energies[3],
-                                                   particleID);
+  // Build the hit.  It lives on the stack while we search the set, so
+  // that only hits in cells we have not seen before have to be allocated.
+  CaloCalibrationHit probe(id,
+                           energies[0],
+                           energies[1],
+                           energies[2],
+                           energies[3],
+                           particleID);
 
-  // If we haven't had a hit in this cell before, create one and add
-  // it to the hit collection.
-      
-  // If we've had a hit in this cell before, then add the energy to
-  // the existing hit.
-      
   // Look for the key in the hitCollection (this is a binary search).
-  auto bookmark = calibrationHits.lower_bound(hit);
- 
-  // The lower_bound method of a map finds the first element
-  // whose key is not less than the identifier.  If this element
-  // == our hit, we've found a match.
-    
-  // Reminders:
-  // bookmark = iterator (pointer) into the hitCollection set.
-  // (*bookmark) = a member of the set, which is a LArG4Hit*.
-    
-  // Equals() is a function defined in LArG4Hit.h; it has the value of
-  // "true" when a LArG4Hit* points to the same identifier.
-    
+  // The lower_bound method finds the first element whose key is not
+  // less than the identifier.  If this element == our hit, we've
+  // found a match.
+  auto bookmark = calibrationHits.lower_bound(&probe);
+
   if (bookmark == calibrationHits.end() ||
-      !(*bookmark)->Equals(hit)) {
-    // We haven't had a hit in this readout cell before.  Add it
-    // to our set.
-    if (calibrationHits.empty() ||
-        bookmark == calibrationHits.begin()) {
-      // Insert the hit before the first entry in the map.
-      calibrationHits.insert(hit);
-    } else {
-      // We'just done a binary search of hitCollection, so we should use
-      // the results of that search to speed up the insertion of a new
-      // hit into the map.  The "insert" method is faster if the new
-      // entry is right _after_ the bookmark.  If we left bookmark
-      // unchanged, the new entry would go right _before_ the
-      // bookmark.  We therefore want to decrement the bookmark from
-      // the lower_bound search.
-            
-      calibrationHits.insert(--bookmark, hit);
-    }
+      !(*bookmark)->Equals(&probe)) {
+    // We haven't had a hit in this readout cell before.  Add it to our
+    // set; the new entry goes right before the bookmark, which makes it
+    // the right hint for the insertion.
+    calibrationHits.insert(bookmark, new CaloCalibrationHit(probe));
   } else {
     // Update the existing hit.
-    (*bookmark)->Add(hit);
-        
-    // We don't need our previously-created hit anymore.
-    delete hit;
+    (*bookmark)->Add(&probe);
   }
 
   return true;
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2024 CERN for the benefit of the ATLAS collaboration
 */
 
 #include "LArG4Code/LArG4SimpleSD.h"
@@ -137,73 +137,30 @@ G4bool LArG4SimpleSD::SimpleHit( const LArG4Identifier& lar_id , G4double time ,
     
   // Find the set of hits for this time bin.  If this is the
   // first hit in this bin, create a new set.
-    
-  hits_t* hitCollection = 0;
-  auto setForThisBin = m_timeBins.find( timeBin );
-    
-  if (setForThisBin == m_timeBins.end()) {
-    // New time bin
-    hitCollection = new hits_t;
-    m_timeBins[ timeBin ] = hitCollection;
-  } else {
-    // Get the existing set of hits for this time bin.
-    // Reminders:
-    // setForThisBin = iterator (pointer) into the m_timeBins map
-    // (*setForThisBin) = pair< G4int, m_hits_t* >
-    // (*setForThisBin).second = m_hits_t*, the pointer to the set of hits
-        
-    hitCollection = (*setForThisBin).second;
-  }
-    
-  LArHit* hit = new LArHit(id,energy,time);
+  hits_t*& hitCollection = m_timeBins[ timeBin ];
+  if (!hitCollection) hitCollection = new hits_t;
+
+  // Probe the set with a hit on the stack, so that only hits in cells
+  // we have not seen before have to be allocated.
+  LArHit probe(id,energy,time);
 
-  // If we haven't had a hit in this cell before, create one and add
-  // it to the hit collection.
-    
-  // If we've had a hit in this cell before, then add the energy to
-  // the existing hit.
-    
   // Look for the key in the hitCollection (this is a binary search).
-  auto bookmark = hitCollection->lower_bound(hit);
-    
-  // The lower_bound method of a map finds the first element
-  // whose key is not less than the identifier.  If this element
-  // == our hit, we've found a match.
-    
-  // Reminders:
-  // bookmark = iterator (pointer) into the hitCollection set.
-  // (*bookmark) = a member of the set, which is a LArG4Hit*.
-    
-  // Equals() is a function defined in LArG4Hit.h; it has the value of
-  // "true" when a LArG4Hit* points to the same identifier.
-    
+  // The lower_bound method finds the first element whose key is not
+  // less than the identifier.  If this element == our hit, we've
+  // found a match.
+  auto bookmark = hitCollection->lower_bound(&probe);
+
   if (bookmark == hitCollection->end() ||
-      !(*bookmark)->Equals(hit)) {
-    // We haven't had a hit in this readout cell before.  Add it
-    // to our set.
-    if (hitCollection->empty() ||
-        bookmark == hitCollection->begin()) {
-      // Insert the hit before the first entry in the map.
-      hitCollection->insert(hit);
-    } else {
-      // We'just done a binary search of hitCollection, so we should use
-      // the results of that search to speed up the insertion of a new
-      // hit into the map.  The "insert" method is faster if the new
-      // entry is right _after_ the bookmark.  If we left bookmark
-      // unchanged, the new entry would go right _before_ the
-      // bookmark.  We therefore want to decrement the bookmark from
-      // the lower_bound search.
-            
-      hitCollection->insert(--bookmark, hit);
-    }
+      !(*bookmark)->Equals(&probe)) {
+    // We haven't had a hit in this readout cell before.  Add it to our
+    // set; the new entry goes right before the bookmark, which makes it
+    // the right hint for the insertion.
+    hitCollection->insert(bookmark, new LArHit(id,energy,time));
   } else {
     // Update the existing hit.
-    (*bookmark)->Add(hit);
-        
-    // We don't need our previously-created hit anymore.
-    delete hit;
+    (*bookmark)->Add(&probe);
   }
-  
+
   return true;
 }
 
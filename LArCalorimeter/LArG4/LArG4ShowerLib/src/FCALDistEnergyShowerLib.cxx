@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2024 CERN for the benefit of the ATLAS collaboration
 */
 
 
@@ -257,6 +257,7 @@ namespace ShowerLib {
 	  //std::cout << "Found out energy" << std::endl;
 	  //std::cout << "Shower with num hits:" << (*etait).second.size() << std::endl;
 	  std::vector<EnergySpot>* outshower = new std::vector<EnergySpot>();//((*etait).second);
+	  outshower->reserve((*distit).second.size());
 	  Shower::const_iterator iter;
 	  //std::cout << "Created out shower" << std::endl;
 
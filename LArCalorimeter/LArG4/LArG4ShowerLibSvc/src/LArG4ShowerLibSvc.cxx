@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2024 CERN for the benefit of the ATLAS collaboration
 */
 
 #include "LArG4ShowerLibSvc/LArG4ShowerLibSvc.h"
@@ -11,7 +11,9 @@
 
 #include "AthenaKernel/Units.h"
 
+#include <memory>
 #include <sstream>
+#include <utility>
 #include "TFile.h"
 #include "TTree.h"
 #include "Randomize.hh"
@@ -225,7 +227,9 @@ LArG4ShowerLibSvc::getShower(const G4FastTrack& track, int detectorTag) const
     }
   }
 
-  return *std::unique_ptr< std::vector<EnergySpot> >(shower);
+  // hand the spots over without copying them
+  std::unique_ptr< std::vector<EnergySpot> > showerOwner(shower);
+  return std::move(*showerOwner);
 }
 
 double
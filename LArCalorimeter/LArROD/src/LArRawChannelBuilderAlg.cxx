@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2024 CERN for the benefit of the ATLAS collaboration
 */
 
 #include "LArRawChannelBuilderAlg.h" 
@@ -89,6 +89,11 @@ StatusCode LArRawChannelBuilderAlg::execute(const EventContext& ctx) const {
     }
   }
 
+  outputContainer->reserve(inputContainer->size());
+
+  //Pedestal-subtracted samples, re-used for all channels to avoid an allocation per digit
+  std::vector<float> samp_no_ped;
+
   //Loop over digits:
   for (const LArDigit* digit : *inputContainer) {
   
@@ -142,14 +147,13 @@ StatusCode LArRawChannelBuilderAlg::execute(const EventContext& ctx) const {
     double A=0;
     bool saturated=false;
 
-    // Check saturation AND discount pedestal
-    std::vector<float> samp_no_ped(nOFC,0.0);
-    for (size_t i=0;i<nOFC;++i) {
-      if (samples[i+firstSample]==4096 || samples[i+firstSample]==0) saturated=true; 
-      samp_no_ped[i]=samples[i+firstSample]-p;
-    }
+    // Check saturation AND discount pedestal, accumulating A in the same pass
+    samp_no_ped.resize(nOFC);
     for (size_t i=0;i<nOFC;++i) {
-       A+=static_cast<double>(samp_no_ped[i])*ofca[i];
+      const short sample=samples[i+firstSample];
+      if (sample==4096 || sample==0) saturated=true; 
+      samp_no_ped[i]=sample-p;
+      A+=static_cast<double>(samp_no_ped[i])*ofca[i];
     }
     
     //Apply Ramp
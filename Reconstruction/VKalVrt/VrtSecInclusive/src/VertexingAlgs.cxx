@@ -69,269 +69,297 @@ namespace VKalVrtAthena {
     // Truth match map
     std::map<const xAOD::TruthVertex*, bool> matchMap;
 
-    // first make all 2-track vertices
-    for( auto itrk = m_selectedTracks->begin(); itrk != m_selectedTracks->end(); ++itrk ) {
-      for( auto jtrk = std::next(itrk); jtrk != m_selectedTracks->end(); ++jtrk ) {
-        
+    // List of all the track pairs, in the order they are processed below. Pairs which pass
+    // the d0 pre-selection carry the index of their fast crude estimation, done for all
+    // of them in one go so that the per-track part of the conversion is done only once.
+    struct TrackPair {
+      int itrk_id;
+      int jtrk_id;
+      int fastIndex;   // -1 if the pair does not pass the d0 pre-selection
+    };
+    std::vector<TrackPair> trackPairs;
+    std::vector<std::pair<int, int>> fastPairs;
+    const int nSelected = m_selectedTracks->size();
+    trackPairs.reserve( nSelected * (nSelected - 1) / 2 );
+    for( int itrk_id = 0; itrk_id < nSelected; ++itrk_id ) {
+      for( int jtrk_id = itrk_id + 1; jtrk_id < nSelected; ++jtrk_id ) {
         // avoid both tracks are too close to the beam line
-        
-        const int itrk_id = itrk - m_selectedTracks->begin();
-        const int jtrk_id = jtrk - m_selectedTracks->begin();
-        
-        WrkVrt wrkvrt;
-        wrkvrt.selectedTrackIndices.emplace_back( itrk_id );
-        wrkvrt.selectedTrackIndices.emplace_back( jtrk_id );
+        int fastIndex = -1;
+        if( std::abs( (*m_selectedTracks)[itrk_id]->d0() ) >= m_jp.twoTrkVtxFormingD0Cut ||
+            std::abs( (*m_selectedTracks)[jtrk_id]->d0() ) >= m_jp.twoTrkVtxFormingD0Cut ) {
+          fastIndex = fastPairs.size();
+          fastPairs.emplace_back( itrk_id, jtrk_id );
+        }
+        trackPairs.push_back( { itrk_id, jtrk_id, fastIndex } );
+      }
+    }
+    std::vector<Amg::Vector3D> fastVertices;
+    std::vector<bool>          fastOK;
+    {
+      std::unique_ptr<Trk::IVKalState> fastState = m_fitSvc->makeState();
+      if( m_fitSvc->VKalVrtFitFastPairs( *m_selectedTracks, fastPairs, fastVertices, fastOK, *fastState ).isFailure() ) {
+        fastOK.assign( fastPairs.size(), false );
+      }
+    }
 
-        // Attempt to think the combination is incompatible by default
-        m_incomp.emplace_back( std::pair<int, int>(itrk_id, jtrk_id) );
-        
-        if( std::abs( (*itrk)->d0() ) < m_jp.twoTrkVtxFormingD0Cut && std::abs( (*jtrk)->d0() ) < m_jp.twoTrkVtxFormingD0Cut ) continue;
+    // first make all 2-track vertices
+    for( const TrackPair& trackPair : trackPairs ) {
+      const int itrk_id = trackPair.itrk_id;
+      const int jtrk_id = trackPair.jtrk_id;
+      const auto itrk = m_selectedTracks->begin() + itrk_id;
+      const auto jtrk = m_selectedTracks->begin() + jtrk_id;
+      
+      WrkVrt wrkvrt;
+      wrkvrt.selectedTrackIndices.emplace_back( itrk_id );
+      wrkvrt.selectedTrackIndices.emplace_back( jtrk_id );
 
-        baseTracks.clear();
-        baseTracks.emplace_back( *itrk );
-        baseTracks.emplace_back( *jtrk );
+      // Attempt to think the combination is incompatible by default
+      m_incomp.emplace_back( std::pair<int, int>(itrk_id, jtrk_id) );
+      
+      if( trackPair.fastIndex < 0 ) continue;
 
-        if( m_jp.FillHist ) m_hists["incompMonitor"]->Fill( kStart );
-        
-        // new code to find initial approximate vertex
-        Amg::Vector3D initVertex;
+      baseTracks.clear();
+      baseTracks.emplace_back( *itrk );
+      baseTracks.emplace_back( *jtrk );
 
-        std::unique_ptr<Trk::IVKalState> state = m_fitSvc->makeState();
-        StatusCode sc = m_fitSvc->VKalVrtFitFast( baseTracks, initVertex, *state );/* Fast crude estimation */
-        if( sc.isFailure() ) {
-          ATH_MSG_DEBUG(" > " << __FUNCTION__ << ": fast crude estimation fails ");
-          continue;
-        }
-        
-        if( initVertex.perp() > maxR ) {
-          continue;
-        }
-        if( m_jp.FillHist ) m_hists["incompMonitor"]->Fill( kInitVtxPosition );
+      if( m_jp.FillHist ) m_hists["incompMonitor"]->Fill( kStart );
+      
+      // initial approximate vertex from the fast crude estimation done above
+      if( !fastOK[trackPair.fastIndex] ) {
+        ATH_MSG_DEBUG(" > " << __FUNCTION__ << ": fast crude estimation fails ");
+        continue;
+      }
+      const Amg::Vector3D& initVertex = fastVertices[trackPair.fastIndex];
+      
+      if( initVertex.perp() > maxR ) {
+        continue;
+      }
+      if( m_jp.FillHist ) m_hists["incompMonitor"]->Fill( kInitVtxPosition );
 
-        std::vector<double> impactParameters;
-        std::vector<double> impactParErrors;
+      std::vector<double> impactParameters;
+      std::vector<double> impactParErrors;
 
-        if( !getSVImpactParameters( *itrk, initVertex, impactParameters, impactParErrors) ) continue;
-        const auto roughD0_itrk = impactParameters.at(TrkParameter::k_d0);
-        const auto roughZ0_itrk = impactParameters.at(TrkParameter::k_z0);
-        if( fabs( impactParameters.at(0)) > roughD0Cut || fabs( impactParameters.at(1) ) > roughZ0Cut ) {
-          continue;
-        }
+      if( !getSVImpactParameters( *itrk, initVertex, impactParameters, impactParErrors) ) continue;
+      const auto roughD0_itrk = impactParameters.at(TrkParameter::k_d0);
+      const auto roughZ0_itrk = impactParameters.at(TrkParameter::k_z0);
+      if( fabs( impactParameters.at(0)) > roughD0Cut || fabs( impactParameters.at(1) ) > roughZ0Cut ) {
+        continue;
+      }
 
-        if( !getSVImpactParameters( *jtrk, initVertex, impactParameters, impactParErrors) ) continue;
-        const auto roughD0_jtrk = impactParameters.at(TrkParameter::k_d0);
-        const auto roughZ0_jtrk = impactParameters.at(TrkParameter::k_z0);
-        if( fabs( impactParameters.at(0) ) > roughD0Cut || fabs( impactParameters.at(1) ) > roughZ0Cut ) {
-          continue;
-        }
-        if( m_jp.FillHist ) m_hists["incompMonitor"]->Fill( kImpactParamCheck );
+      if( !getSVImpactParameters( *jtrk, initVertex, impactParameters, impactParErrors) ) continue;
+      const auto roughD0_jtrk = impactParameters.at(TrkParameter::k_d0);
+      const auto roughZ0_jtrk = impactParameters.at(TrkParameter::k_z0);
+      if( fabs( impactParameters.at(0) ) > roughD0Cut || fabs( impactParameters.at(1) ) > roughZ0Cut ) {
+        continue;
+      }
+      if( m_jp.FillHist ) m_hists["incompMonitor"]->Fill( kImpactParamCheck );
 
-        m_fitSvc->setApproximateVertex( initVertex.x(), initVertex.y(), initVertex.z(), *state );
+      std::unique_ptr<Trk::IVKalState> state = m_fitSvc->makeState();
+      m_fitSvc->setApproximateVertex( initVertex.x(), initVertex.y(), initVertex.z(), *state );
 
-        
-        
-        // Vertex VKal Fitting
-        sc = m_fitSvc->VKalVrtFit( baseTracks,
-                                   dummyNeutrals,
-                                   wrkvrt.vertex, wrkvrt.vertexMom, wrkvrt.Charge,
-                                   wrkvrt.vertexCov, wrkvrt.Chi2PerTrk,
-                                   wrkvrt.TrkAtVrt, wrkvrt.Chi2, *state  );
-        
-        if( sc.isFailure() ) {
-          continue;          /* No fit */ 
-        }
-        if( m_jp.FillHist ) m_hists["incompMonitor"]->Fill( kVKalVrtFit );
-        
-        // Compatibility to the primary vertex.
-        Amg::Vector3D vDist = wrkvrt.vertex - m_thePV->position();
-        const double vPos = ( vDist.x()*wrkvrt.vertexMom.Px()+vDist.y()*wrkvrt.vertexMom.Py()+vDist.z()*wrkvrt.vertexMom.Pz() )/wrkvrt.vertexMom.Rho();
-        const double vPosMomAngT = ( vDist.x()*wrkvrt.vertexMom.Px()+vDist.y()*wrkvrt.vertexMom.Py() ) / vDist.perp() / wrkvrt.vertexMom.Pt();
-        const double vPosMomAng3D = ( vDist.x()*wrkvrt.vertexMom.Px()+vDist.y()*wrkvrt.vertexMom.Py()+vDist.z()*wrkvrt.vertexMom.Pz() ) / (vDist.norm() * wrkvrt.vertexMom.Rho());
-        
-        double dphi1 = TVector2::Phi_mpi_pi(vDist.phi() - (*itrk)->phi());
-        double dphi2 = TVector2::Phi_mpi_pi(vDist.phi() - (*jtrk)->phi());
-        
-        const double dist_fromPV = vDist.norm();
-        if( m_jp.FillHist ) m_hists["2trkVtxDistFromPV"]->Fill( dist_fromPV );
-        
-        if( m_jp.FillNtuple ) {
-          // Fill the 2-track vertex properties to AANT
-          m_ntupleVars->get<unsigned int>( "All2TrkVrtNum" )++;
-          m_ntupleVars->get< std::vector<double> >( "All2TrkVrtMass" )   .emplace_back(wrkvrt.vertexMom.M());
-          m_ntupleVars->get< std::vector<double> >( "All2TrkVrtPt" )     .emplace_back(wrkvrt.vertexMom.Perp());
-          m_ntupleVars->get< std::vector<int> >   ( "All2TrkVrtCharge" ) .emplace_back(wrkvrt.Charge);
-          m_ntupleVars->get< std::vector<double> >( "All2TrkVrtX" )      .emplace_back(wrkvrt.vertex.x());
-          m_ntupleVars->get< std::vector<double> >( "All2TrkVrtY" )      .emplace_back(wrkvrt.vertex.y());
-          m_ntupleVars->get< std::vector<double> >( "All2TrkVrtZ" )      .emplace_back(wrkvrt.vertex.z());
-          m_ntupleVars->get< std::vector<double> >( "All2TrkVrtChiSq" )  .emplace_back(wrkvrt.Chi2);
-        }
+      
+      
+      // Vertex VKal Fitting
+      StatusCode sc = m_fitSvc->VKalVrtFit( baseTracks,
+                                 dummyNeutrals,
+                                 wrkvrt.vertex, wrkvrt.vertexMom, wrkvrt.Charge,
+                                 wrkvrt.vertexCov, wrkvrt.Chi2PerTrk,
+                                 wrkvrt.TrkAtVrt, wrkvrt.Chi2, *state  );
+      
+      if( sc.isFailure() ) {
+        continue;          /* No fit */ 
+      }
+      if( m_jp.FillHist ) m_hists["incompMonitor"]->Fill( kVKalVrtFit );
+      
+      // Compatibility to the primary vertex.
+      Amg::Vector3D vDist = wrkvrt.vertex - m_thePV->position();
+      const double vPos = ( vDist.x()*wrkvrt.vertexMom.Px()+vDist.y()*wrkvrt.vertexMom.Py()+vDist.z()*wrkvrt.vertexMom.Pz() )/wrkvrt.vertexMom.Rho();
+      const double vPosMomAngT = ( vDist.x()*wrkvrt.vertexMom.Px()+vDist.y()*wrkvrt.vertexMom.Py() ) / vDist.perp() / wrkvrt.vertexMom.Pt();
+      const double vPosMomAng3D = ( vDist.x()*wrkvrt.vertexMom.Px()+vDist.y()*wrkvrt.vertexMom.Py()+vDist.z()*wrkvrt.vertexMom.Pz() ) / (vDist.norm() * wrkvrt.vertexMom.Rho());
+      
+      double dphi1 = TVector2::Phi_mpi_pi(vDist.phi() - (*itrk)->phi());
+      double dphi2 = TVector2::Phi_mpi_pi(vDist.phi() - (*jtrk)->phi());
+      
+      const double dist_fromPV = vDist.norm();
+      if( m_jp.FillHist ) m_hists["2trkVtxDistFromPV"]->Fill( dist_fromPV );
+      
+      if( m_jp.FillNtuple ) {
+        // Fill the 2-track vertex properties to AANT
+        m_ntupleVars->get<unsigned int>( "All2TrkVrtNum" )++;
+        m_ntupleVars->get< std::vector<double> >( "All2TrkVrtMass" )   .emplace_back(wrkvrt.vertexMom.M());
+        m_ntupleVars->get< std::vector<double> >( "All2TrkVrtPt" )     .emplace_back(wrkvrt.vertexMom.Perp());
+        m_ntupleVars->get< std::vector<int> >   ( "All2TrkVrtCharge" ) .emplace_back(wrkvrt.Charge);
+        m_ntupleVars->get< std::vector<double> >( "All2TrkVrtX" )      .emplace_back(wrkvrt.vertex.x());
+        m_ntupleVars->get< std::vector<double> >( "All2TrkVrtY" )      .emplace_back(wrkvrt.vertex.y());
+        m_ntupleVars->get< std::vector<double> >( "All2TrkVrtZ" )      .emplace_back(wrkvrt.vertex.z());
+        m_ntupleVars->get< std::vector<double> >( "All2TrkVrtChiSq" )  .emplace_back(wrkvrt.Chi2);
+      }
 
 
-        // Create a xAOD::Vertex instance
-        xAOD::Vertex *vertex { nullptr };
-        
-        if( m_jp.FillIntermediateVertices ) {
-          vertex = new xAOD::Vertex;
-          twoTrksVertexContainer->emplace_back( vertex );
+      // Create a xAOD::Vertex instance
+      xAOD::Vertex *vertex { nullptr };
+      
+      if( m_jp.FillIntermediateVertices ) {
+        vertex = new xAOD::Vertex;
+        twoTrksVertexContainer->emplace_back( vertex );
 
-          for( auto *trk: baseTracks ) {
+        for( auto *trk: baseTracks ) {
 
-            // Acquire link to the track
-            ElementLink<xAOD::TrackParticleContainer>  trackElementLink( *( dynamic_cast<const xAOD::TrackParticleContainer*>( trk->container() ) ), trk->index() );
+          // Acquire link to the track
+          ElementLink<xAOD::TrackParticleContainer>  trackElementLink( *( dynamic_cast<const xAOD::TrackParticleContainer*>( trk->container() ) ), trk->index() );
 
-            // Register link to the vertex
-            vertex->addTrackAtVertex( trackElementLink, 1. );
-          }
+          // Register link to the vertex
+          vertex->addTrackAtVertex( trackElementLink, 1. );
+        }
 
-          vertex->setVertexType( xAOD::VxType::SecVtx );
-          vertex->setPosition( wrkvrt.vertex );
-          vertex->setFitQuality( wrkvrt.Chi2, 1 ); // Ndof is always 1
+        vertex->setVertexType( xAOD::VxType::SecVtx );
+        vertex->setPosition( wrkvrt.vertex );
+        vertex->setFitQuality( wrkvrt.Chi2, 1 ); // Ndof is always 1
 
-          vertex->auxdata<float>("mass")   = wrkvrt.vertexMom.M();
-          vertex->auxdata<float>("pT")     = wrkvrt.vertexMom.Perp();
-          vertex->auxdata<float>("charge") = wrkvrt.Charge;
-          vertex->auxdata<float>("vPos")   = vPos;
-          vertex->auxdata<bool>("isFake")  = true;
-        }
+        vertex->auxdata<float>("mass")   = wrkvrt.vertexMom.M();
+        vertex->auxdata<float>("pT")     = wrkvrt.vertexMom.Perp();
+        vertex->auxdata<float>("charge") = wrkvrt.Charge;
+        vertex->auxdata<float>("vPos")   = vPos;
+        vertex->auxdata<bool>("isFake")  = true;
+      }
 
 
-        /////////////////////////////
+      /////////////////////////////
 
-        uint8_t trkiBLHit,trkjBLHit;
-        if( !((*itrk)->summaryValue( trkiBLHit,xAOD::numberOfInnermostPixelLayerHits)))  trkiBLHit=0;
-        if( !((*jtrk)->summaryValue( trkjBLHit,xAOD::numberOfInnermostPixelLayerHits)))  trkjBLHit=0;
+      uint8_t trkiBLHit,trkjBLHit;
+      if( !((*itrk)->summaryValue( trkiBLHit,xAOD::numberOfInnermostPixelLayerHits)))  trkiBLHit=0;
+      if( !((*jtrk)->summaryValue( trkjBLHit,xAOD::numberOfInnermostPixelLayerHits)))  trkjBLHit=0;
 
-        if( m_jp.FillNtuple ) m_ntupleVars->get< std::vector<int> >( "All2TrkSumBLHits" ).emplace_back( trkiBLHit + trkjBLHit );
+      if( m_jp.FillNtuple ) m_ntupleVars->get< std::vector<int> >( "All2TrkSumBLHits" ).emplace_back( trkiBLHit + trkjBLHit );
 
-        // track chi2 cut
-        if( m_jp.FillHist ) m_hists["2trkChi2Dist"]->Fill( log10( wrkvrt.Chi2 ) );
+      // track chi2 cut
+      if( m_jp.FillHist ) m_hists["2trkChi2Dist"]->Fill( log10( wrkvrt.Chi2 ) );
+      
+      if( wrkvrt.fitQuality() > m_jp.SelVrtChi2Cut) {
+        ATH_MSG_VERBOSE(" > " << __FUNCTION__ << ": failed to pass chi2 threshold." );
+        continue;          /* Bad Chi2 */
+      }
+      if( m_jp.FillHist ) m_hists["incompMonitor"]->Fill( kChi2 );
+      
+      
+      ATH_MSG_DEBUG(" > " << __FUNCTION__ << ": attempting form vertex from ( " << itrk_id << ", " << jtrk_id << " )." );
+      ATH_MSG_DEBUG( " > " << __FUNCTION__ << ": candidate vertex: "
+                     << " isGood  = "            << (wrkvrt.isGood? "true" : "false")
+                     << ", #ntrks = "            << wrkvrt.nTracksTotal()
+                     << ", #selectedTracks = "   << wrkvrt.selectedTrackIndices.size()
+                     << ", #associatedTracks = " << wrkvrt.associatedTrackIndices.size()
+                     << ", chi2/ndof = "         << wrkvrt.fitQuality()
+                     << ", (r, z) = ("           << wrkvrt.vertex.perp()
+                     <<", "                      << wrkvrt.vertex.z() << ")" );
+      
+      for( const auto* truthVertex : m_tracingTruthVertices ) {
+        Amg::Vector3D vTruth( truthVertex->x(), truthVertex->y(), truthVertex->z() );
+        Amg::Vector3D vReco ( wrkvrt.vertex.x(), wrkvrt.vertex.y(), wrkvrt.vertex.z() );
+        
+        const auto distance = vReco - vTruth;
+        
+        AmgSymMatrix(3) cov;
+        cov.fillSymmetric( 0, 0, wrkvrt.vertexCov.at(0) );
+        cov.fillSymmetric( 1, 0, wrkvrt.vertexCov.at(1) );
+        cov.fillSymmetric( 1, 1, wrkvrt.vertexCov.at(2) );
+        cov.fillSymmetric( 2, 0, wrkvrt.vertexCov.at(3) );
+        cov.fillSymmetric( 2, 1, wrkvrt.vertexCov.at(4) );
+        cov.fillSymmetric( 2, 2, wrkvrt.vertexCov.at(5) );
+
+        const double s2 = distance.transpose() * cov.inverse() * distance;
         
-        if( wrkvrt.fitQuality() > m_jp.SelVrtChi2Cut) {
-          ATH_MSG_VERBOSE(" > " << __FUNCTION__ << ": failed to pass chi2 threshold." );
-          continue;          /* Bad Chi2 */
+        if( distance.norm() < 2.0 || s2 < 100. )  {
+          ATH_MSG_DEBUG ( " > " << __FUNCTION__ << ": truth-matched candidate! : signif^2 = " << s2 );
+          matchMap.emplace( truthVertex, true );
+        }
+      }
+
+      if( m_jp.FillHist ) {
+        dynamic_cast<TH2F*>( m_hists["vPosDist"] )->Fill( wrkvrt.vertex.perp(), vPos );
+        dynamic_cast<TH2F*>( m_hists["vPosMomAngTDist"] )->Fill( wrkvrt.vertex.perp(), vPosMomAngT );
+        m_hists["vPosMomAngT"] ->Fill( vPosMomAngT );
+        m_hists["vPosMomAng3D"] ->Fill(  vPosMomAng3D );
+      }
+
+      if( m_jp.doTwoTrSoftBtag ){
+        if(dist_fromPV < m_jp.twoTrVrtMinDistFromPV ){
+          ATH_MSG_DEBUG(" > " << __FUNCTION__ << ": failed to pass the 2tr vertex min distance from PV cut." );
+          continue;
         }
-        if( m_jp.FillHist ) m_hists["incompMonitor"]->Fill( kChi2 );
-        
-        
-        ATH_MSG_DEBUG(" > " << __FUNCTION__ << ": attempting form vertex from ( " << itrk_id << ", " << jtrk_id << " )." );
-        ATH_MSG_DEBUG( " > " << __FUNCTION__ << ": candidate vertex: "
-                       << " isGood  = "            << (wrkvrt.isGood? "true" : "false")
-                       << ", #ntrks = "            << wrkvrt.nTracksTotal()
-                       << ", #selectedTracks = "   << wrkvrt.selectedTrackIndices.size()
-                       << ", #associatedTracks = " << wrkvrt.associatedTrackIndices.size()
-                       << ", chi2/ndof = "         << wrkvrt.fitQuality()
-                       << ", (r, z) = ("           << wrkvrt.vertex.perp()
-                       <<", "                      << wrkvrt.vertex.z() << ")" );
-        
-        for( const auto* truthVertex : m_tracingTruthVertices ) {
-          Amg::Vector3D vTruth( truthVertex->x(), truthVertex->y(), truthVertex->z() );
-          Amg::Vector3D vReco ( wrkvrt.vertex.x(), wrkvrt.vertex.y(), wrkvrt.vertex.z() );
-          
-          const auto distance = vReco - vTruth;
-          
-          AmgSymMatrix(3) cov;
-          cov.fillSymmetric( 0, 0, wrkvrt.vertexCov.at(0) );
-          cov.fillSymmetric( 1, 0, wrkvrt.vertexCov.at(1) );
-          cov.fillSymmetric( 1, 1, wrkvrt.vertexCov.at(2) );
-          cov.fillSymmetric( 2, 0, wrkvrt.vertexCov.at(3) );
-          cov.fillSymmetric( 2, 1, wrkvrt.vertexCov.at(4) );
-          cov.fillSymmetric( 2, 2, wrkvrt.vertexCov.at(5) );
-
-          const double s2 = distance.transpose() * cov.inverse() * distance;
           
-          if( distance.norm() < 2.0 || s2 < 100. )  {
-            ATH_MSG_DEBUG ( " > " << __FUNCTION__ << ": truth-matched candidate! : signif^2 = " << s2 );
-            matchMap.emplace( truthVertex, true );
-          }
+        if( vPosMomAng3D < m_jp.twoTrVrtAngleCut ){
+          ATH_MSG_DEBUG(" > " << __FUNCTION__ << ": failed to pass the vertex angle cut." );
+          continue;
         }
+      }
 
-        if( m_jp.FillHist ) {
-          dynamic_cast<TH2F*>( m_hists["vPosDist"] )->Fill( wrkvrt.vertex.perp(), vPos );
-          dynamic_cast<TH2F*>( m_hists["vPosMomAngTDist"] )->Fill( wrkvrt.vertex.perp(), vPosMomAngT );
-          m_hists["vPosMomAngT"] ->Fill( vPosMomAngT );
-          m_hists["vPosMomAng3D"] ->Fill(  vPosMomAng3D );
+      if( m_jp.doPVcompatibilityCut ) {
+        if( cos( dphi1 ) < -0.8 && cos( dphi2 ) < -0.8 ) {
+          ATH_MSG_DEBUG(" > " << __FUNCTION__ << ": failed to pass the vPos cut. (both tracks are opposite against the vertex pos)" );
+          continue;
         }
-
-        if( m_jp.doTwoTrSoftBtag ){
-          if(dist_fromPV < m_jp.twoTrVrtMinDistFromPV ){
-            ATH_MSG_DEBUG(" > " << __FUNCTION__ << ": failed to pass the 2tr vertex min distance from PV cut." );
-            continue;
-          }
-            
-          if( vPosMomAng3D < m_jp.twoTrVrtAngleCut ){
-            ATH_MSG_DEBUG(" > " << __FUNCTION__ << ": failed to pass the vertex angle cut." );
-            continue;
-          }
+        if (m_jp.doTightPVcompatibilityCut && (cos( dphi1 ) < -0.8 || cos( dphi2 ) < -0.8)){
+          ATH_MSG_DEBUG(" > "<< __FUNCTION__ << ": failed to pass the tightened vPos cut. (at least one track is opposite against the vertex pos)" );
+          continue;
         }
-
-        if( m_jp.doPVcompatibilityCut ) {
-          if( cos( dphi1 ) < -0.8 && cos( dphi2 ) < -0.8 ) {
-            ATH_MSG_DEBUG(" > " << __FUNCTION__ << ": failed to pass the vPos cut. (both tracks are opposite against the vertex pos)" );
-            continue;
-          }
-          if (m_jp.doTightPVcompatibilityCut && (cos( dphi1 ) < -0.8 || cos( dphi2 ) < -0.8)){
-            ATH_MSG_DEBUG(" > "<< __FUNCTION__ << ": failed to pass the tightened vPos cut. (at least one track is opposite against the vertex pos)" );
-            continue;
-          }
-          if( vPosMomAngT < -0.8 ) {
-            ATH_MSG_DEBUG(" > " << __FUNCTION__ << ": failed to pass the vPos cut. (pos-mom directions are opposite)" );
-            continue;
-          }
-          if( vPos < m_jp.pvCompatibilityCut ) {
-            ATH_MSG_DEBUG(" > " << __FUNCTION__ << ": failed to pass the vPos cut." );
-            continue;
-          }
+        if( vPosMomAngT < -0.8 ) {
+          ATH_MSG_DEBUG(" > " << __FUNCTION__ << ": failed to pass the vPos cut. (pos-mom directions are opposite)" );
+          continue;
         }
-        if( m_jp.FillHist ) m_hists["incompMonitor"]->Fill( kVposCut );
-        
-        // fake rejection cuts with track hit pattern consistencies
-        if( m_jp.removeFakeVrt && !m_jp.removeFakeVrtLate ) {
-          if( !this->passedFakeReject( wrkvrt.vertex, (*itrk), (*jtrk) ) ) {
-            
-            ATH_MSG_DEBUG(" > " << __FUNCTION__ << ": failed to pass fake rejection algorithm." );
-            continue;
-          }
+        if( vPos < m_jp.pvCompatibilityCut ) {
+          ATH_MSG_DEBUG(" > " << __FUNCTION__ << ": failed to pass the vPos cut." );
+          continue;
         }
-        if( m_jp.FillHist ) m_hists["incompMonitor"]->Fill( kPatternMatch );
-        
-        ATH_MSG_DEBUG(" > " << __FUNCTION__ << ": passed fake rejection." );
-        
-        if( m_jp.FillNtuple ) {
-          // Fill AANT for vertices after fake rejection
-          m_ntupleVars->get< unsigned int >( "AfFakVrtNum" )++;
-          m_ntupleVars->get< std::vector<double> >( "AfFakVrtMass" )   .emplace_back(wrkvrt.vertexMom.M());
-          m_ntupleVars->get< std::vector<double> >( "AfFakVrtPt" )     .emplace_back(wrkvrt.vertexMom.Perp());
-          m_ntupleVars->get< std::vector<int> >   ( "AfFakVrtCharge" ) .emplace_back(wrkvrt.Charge);
-          m_ntupleVars->get< std::vector<double> >( "AfFakVrtX" )      .emplace_back(wrkvrt.vertex.x());
-          m_ntupleVars->get< std::vector<double> >( "AfFakVrtY" )      .emplace_back(wrkvrt.vertex.y());
-          m_ntupleVars->get< std::vector<double> >( "AfFakVrtZ" )      .emplace_back(wrkvrt.vertex.z());
-          m_ntupleVars->get< std::vector<double> >( "AfFakVrtChiSq" )  .emplace_back(wrkvrt.Chi2);
+      }
+      if( m_jp.FillHist ) m_hists["incompMonitor"]->Fill( kVposCut );
+      
+      // fake rejection cuts with track hit pattern consistencies
+      if( m_jp.removeFakeVrt && !m_jp.removeFakeVrtLate ) {
+        if( !this->passedFakeReject( wrkvrt.vertex, (*itrk), (*jtrk) ) ) {
+          
+          ATH_MSG_DEBUG(" > " << __FUNCTION__ << ": failed to pass fake rejection algorithm." );
+          continue;
         }
+      }
+      if( m_jp.FillHist ) m_hists["incompMonitor"]->Fill( kPatternMatch );
+      
+      ATH_MSG_DEBUG(" > " << __FUNCTION__ << ": passed fake rejection." );
+      
+      if( m_jp.FillNtuple ) {
+        // Fill AANT for vertices after fake rejection
+        m_ntupleVars->get< unsigned int >( "AfFakVrtNum" )++;
+        m_ntupleVars->get< std::vector<double> >( "AfFakVrtMass" )   .emplace_back(wrkvrt.vertexMom.M());
+        m_ntupleVars->get< std::vector<double> >( "AfFakVrtPt" )     .emplace_back(wrkvrt.vertexMom.Perp());
+        m_ntupleVars->get< std::vector<int> >   ( "AfFakVrtCharge" ) .emplace_back(wrkvrt.Charge);
+        m_ntupleVars->get< std::vector<double> >( "AfFakVrtX" )      .emplace_back(wrkvrt.vertex.x());
+        m_ntupleVars->get< std::vector<double> >( "AfFakVrtY" )      .emplace_back(wrkvrt.vertex.y());
+        m_ntupleVars->get< std::vector<double> >( "AfFakVrtZ" )      .emplace_back(wrkvrt.vertex.z());
+        m_ntupleVars->get< std::vector<double> >( "AfFakVrtChiSq" )  .emplace_back(wrkvrt.Chi2);
+      }
 
-        // The vertex passed the quality cut: overwrite isFake to false
-        if( m_jp.FillIntermediateVertices && vertex ) {
-          vertex->auxdata<bool>("isFake")  = false;
-        }
+      // The vertex passed the quality cut: overwrite isFake to false
+      if( m_jp.FillIntermediateVertices && vertex ) {
+        vertex->auxdata<bool>("isFake")  = false;
+      }
 
-        
-        // Now this vertex passed all criteria and considred to be a compatible vertices.
-        // Therefore the track pair is removed from the incompatibility list.
-        m_incomp.pop_back();
-        
-        wrkvrt.isGood = true;
-        
-        workVerticesContainer->emplace_back( wrkvrt );
-        
-        msg += Form(" (%d, %d), ", itrk_id, jtrk_id );
-        
-        if( m_jp.FillHist ) {
-          m_hists["initVertexDispD0"]->Fill( roughD0_itrk, initVertex.perp() );
-          m_hists["initVertexDispD0"]->Fill( roughD0_jtrk, initVertex.perp() );
-          m_hists["initVertexDispZ0"]->Fill( roughZ0_itrk, initVertex.z()    );
-          m_hists["initVertexDispZ0"]->Fill( roughZ0_jtrk, initVertex.z()    );
-        }
-        
+      
+      // Now this vertex passed all criteria and considred to be a compatible vertices.
+      // Therefore the track pair is removed from the incompatibility list.
+      m_incomp.pop_back();
+      
+      wrkvrt.isGood = true;
+      
+      workVerticesContainer->emplace_back( wrkvrt );
+      
+      msg += Form(" (%d, %d), ", itrk_id, jtrk_id );
+      
+      if( m_jp.FillHist ) {
+        m_hists["initVertexDispD0"]->Fill( roughD0_itrk, initVertex.perp() );
+        m_hists["initVertexDispD0"]->Fill( roughD0_jtrk, initVertex.perp() );
+        m_hists["initVertexDispZ0"]->Fill( roughZ0_itrk, initVertex.z()    );
+        m_hists["initVertexDispZ0"]->Fill( roughZ0_jtrk, initVertex.z()    );
       }
+      
     }
 
     
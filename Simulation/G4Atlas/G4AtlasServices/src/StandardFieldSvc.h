@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2024 CERN for the benefit of the ATLAS collaboration
 */
 
 #ifndef G4ATLASSERVICES_StandardFieldSvc_H
@@ -47,14 +47,43 @@ class AtlasField : public G4MagneticField
     /// Implementation of G4 method to retrieve field value
     void GetFieldValue(const double *point, double *field) const
     {
-        if (m_magFieldSvc) m_magFieldSvc->getField(point, field);
-        else               m_fieldCache.getField(point, field);
+        if (m_magFieldSvc) {
+            m_magFieldSvc->getField(point, field);
+            return;
+        }
+        // The steppers and the chord finder frequently re-evaluate the field at
+        // the point of the previous call (e.g. the start of a new step), so
+        // return the memoised value in that case. The field is static, hence
+        // the time component of the point is ignored.
+        if (m_lastValid &&
+            point[0] == m_lastPoint[0] &&
+            point[1] == m_lastPoint[1] &&
+            point[2] == m_lastPoint[2]) {
+            field[0] = m_lastField[0];
+            field[1] = m_lastField[1];
+            field[2] = m_lastField[2];
+            return;
+        }
+        m_fieldCache.getField(point, field);
+        m_lastPoint[0] = point[0];
+        m_lastPoint[1] = point[1];
+        m_lastPoint[2] = point[2];
+        m_lastField[0] = field[0];
+        m_lastField[1] = field[1];
+        m_lastField[2] = field[2];
+        m_lastValid = true;
     }
 
   private:
     /// Field cache - mutable because getField modifies the cache
     mutable MagField::AtlasFieldCache m_fieldCache ATLAS_THREAD_SAFE;
 
+    /// Last point evaluated with the field cache and the field found there.
+    /// The field object is thread-local, so these need no synchronisation.
+    mutable double m_lastPoint[3] ATLAS_THREAD_SAFE {0., 0., 0.};
+    mutable double m_lastField[3] ATLAS_THREAD_SAFE {0., 0., 0.};
+    mutable bool m_lastValid ATLAS_THREAD_SAFE {false};
+
     /// Pointer to the magnetic field service.
     /// We use a raw pointer here to avoid ServiceHandle overhead.
     MagField::IMagFieldSvc* m_magFieldSvc{nullptr};
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2020 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2024 CERN for the benefit of the ATLAS collaboration
 */
 
 #ifndef HITMANAGEMENT_TIMEDHITCOLLECTION
@@ -9,6 +9,7 @@
 #include <vector>
 #include "HitManagement/AtlasHitsVector.h"
 #include "HitManagement/TimedHitPtr.h"
+#include "HitManagement/TimedHitSortKey.h"
 #include "EventInfo/PileUpTimeEventIndex.h"
 
 template <class HIT>
@@ -0,0 +1,25 @@
+/*
+  Copyright (C) 2002-2024 CERN for the benefit of the ATLAS collaboration
+*/
+
+#ifndef HITMANAGEMENT_TIMEDHITSORTKEY
+#define HITMANAGEMENT_TIMEDHITSORTKEY
+
+/** @brief Optional integer sort key of a hit type.
+ *
+ * TimedHitCollection sorts hits with HIT::operator<, dereferencing two hits
+ * per comparison. A hit type can specialize this template to expose its
+ * ordering as an integer key instead:
+ *   static constexpr bool available = true;
+ *   typedef ... key_type;
+ *   static key_type key(const HIT&);
+ * Comparing the keys must give the same ordering as HIT::operator<.
+ * The specialization must be visible wherever the hit type is complete,
+ * i.e. it belongs in the hit's own header.
+ */
+template <class HIT>
+struct TimedHitSortKey {
+  static constexpr bool available = false;
+};
+
+#endif
@@ -0,0 +1,117 @@
+/*
+  Copyright (C) 2002-2024 CERN for the benefit of the ATLAS collaboration
+*/
+
+/**
+ * @brief test the ordering of TimedHitCollection, with and without TimedHitSortKey
+ * @author ATLAS Collaboration
+ */
+
+#undef NDEBUG
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <vector>
+#include "HitManagement/TimedHitCollection.h"
+
+// Hit with an integer sort key
+struct KeyedHit {
+  KeyedHit(float T, int I) : t(T), id(I) {}
+  float t;
+  int id;
+};
+float hitTime(const KeyedHit& h) { return h.t; }
+bool operator < (const KeyedHit& lhs, const KeyedHit& rhs) {
+  return (lhs.id < rhs.id);
+}
+
+template <>
+struct TimedHitSortKey<KeyedHit> {
+  static constexpr bool available = true;
+  typedef int key_type;
+  static key_type key(const KeyedHit& hit) { return hit.id; }
+};
+
+// Same hit without the key: sorted with stable_sort
+struct PlainHit {
+  PlainHit(float T, int I) : t(T), id(I) {}
+  float t;
+  int id;
+};
+float hitTime(const PlainHit& h) { return h.t; }
+bool operator < (const PlainHit& lhs, const PlainHit& rhs) {
+  return (lhs.id < rhs.id);
+}
+
+
+#include "TestTools/initGaudi.h"
+using namespace Athena_test;
+
+using namespace std;
+
+// Fill one collection per bunch crossing, with many duplicate ids within
+// and across the bunch crossings, and check that the collection walks the
+// hits in the order given by std::stable_sort.
+template <class HIT>
+void testOrder() {
+  const int nBunchCrossings = 5;
+  vector<AtlasHitsVector<HIT> > inputs;
+  inputs.reserve(nBunchCrossings);
+  unsigned int seed = 12345;
+  for (int bc = 0; bc < nBunchCrossings; ++bc) {
+    inputs.emplace_back("TestHits", 100);
+    for (int i = 0; i < 60; ++i) {
+      seed = 1664525*seed + 1013904223;
+      // only 20 different ids
+      inputs.back().Emplace(float(i), int((seed >> 16) % 20));
+    }
+  }
+
+  TimedHitCollection<HIT> thc;
+  vector<TimedHitPtr<HIT> > expected;
+  for (int bc = 0; bc < nBunchCrossings; ++bc) {
+    const PileUpTimeEventIndex index(25*(bc - 2), bc, PileUpTimeEventIndex::MinimumBias);
+    thc.insert(index, &inputs[bc]);
+    for (const HIT& hit : inputs[bc]) {
+      expected.emplace_back(index.time(), index.index(), &hit, index.type());
+    }
+  }
+  stable_sort(expected.begin(), expected.end());
+
+  typename TimedHitCollection<HIT>::const_iterator i, e;
+  size_t n = 0;
+  int nElements = 0;
+  while (thc.nextDetectorElement(i, e)) {
+    ++nElements;
+    const int id = (*i)->id;
+    while (i != e) {
+      assert(n < expected.size());
+      // same hit, from the same bunch crossing, at the same position
+      assert(&**i == &*expected[n]);
+      assert((*i)->id == id);
+      assert(i->eventTime() == expected[n].eventTime());
+      assert(i->eventId() == expected[n].eventId());
+      assert(i->pileupType() == expected[n].pileupType());
+      ++i;
+      ++n;
+    }
+  }
+  assert(n == expected.size());
+  assert(nElements <= 20);
+}
+
+int main() {
+  cout << "*** TimedHitCollection_test starts ***" <<endl;
+  ISvcLocator* pSvcLoc;
+  if (!initGaudi(pSvcLoc)) {
+    cerr << "This test can not be run" << endl;
+    return 0;
+  }
+  assert(pSvcLoc);
+  static_assert(TimedHitSortKey<KeyedHit>::available);
+  static_assert(!TimedHitSortKey<PlainHit>::available);
+  testOrder<KeyedHit>();
+  testOrder<PlainHit>();
+  cout << "*** TimedHitCollection_test OK ***" <<endl;
+  return 0;
+}
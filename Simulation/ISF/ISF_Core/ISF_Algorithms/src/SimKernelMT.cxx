@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2024 CERN for the benefit of the ATLAS collaboration
 */
 
 /**
@@ -18,6 +18,7 @@
 
 // STL
 #include <queue>
+#include <unordered_map>
 #include <utility>
 
 #undef ISFDEBUG
@@ -193,6 +194,9 @@ StatusCode ISF::SimKernelMT::execute() {
   ISF::ISFParticleVector particles{};
   ISimulatorTool* lastSimulator{};
   ISFParticleContainer newSecondaries{};
+  // Simulator of each particle deferred to a later pass. Deferred particles
+  // are not modified in the meantime, so their routing is only resolved once.
+  std::unordered_map<const ISFParticle*, ISimulatorTool*> deferredRouting{};
   while ( particleQueue.size() ) {
     ++loopCounter;
     ATH_MSG_VERBOSE("Main Loop pass no. " << loopCounter);
@@ -204,23 +208,32 @@ StatusCode ISF::SimKernelMT::execute() {
       ISFParticle& curParticle( *particlePtr );
       particleQueue.pop();
 
-      // Get the geo ID for the particle
-      if ( m_forceGeoIDSvc || !validAtlasRegion( curParticle.nextGeoID() ) ) {
-        m_geoIDSvc->identifyAndRegNextGeoID( curParticle );
+      ISimulatorTool* simTool{};
+      auto routed = deferredRouting.find(particlePtr);
+      if ( routed != deferredRouting.end() ) {
+        simTool = routed->second;
+        deferredRouting.erase(routed);
       }
+      else {
+        // Get the geo ID for the particle
+        if ( m_forceGeoIDSvc || !validAtlasRegion( curParticle.nextGeoID() ) ) {
+          m_geoIDSvc->identifyAndRegNextGeoID( curParticle );
+        }
 
-      // Get the simulator using the GeoID
-      auto& simTool = identifySimulator(curParticle);
+        // Get the simulator using the GeoID
+        simTool = &identifySimulator(curParticle);
+      }
 
       // Fill the vector
       if ( particles.empty() ) {
         // First particle in the vector defines the simulator
         particles.push_back(particlePtr);
-        lastSimulator=&simTool;
+        lastSimulator=simTool;
       }
-      else if (&simTool!=lastSimulator || particles.size() >= m_maxParticleVectorSize ) {
+      else if (simTool!=lastSimulator || particles.size() >= m_maxParticleVectorSize ) {
         // Change of simulator, end the current vector
         tempQueue.push(particlePtr);
+        deferredRouting.emplace(particlePtr, simTool);
       }
       else {
         particles.push_back(particlePtr);
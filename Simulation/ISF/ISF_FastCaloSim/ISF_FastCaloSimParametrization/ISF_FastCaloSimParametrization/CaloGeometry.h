@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2024 CERN for the benefit of the ATLAS collaboration
 */
 
 #ifndef ISF_FASTCALOSIMPARAMETRIZATION_CALOGEOMETRY_H
@@ -98,11 +98,24 @@ class CaloGeometry : virtual public ICaloGeometry {
 
     virtual void InitRZmaps();
 
+    virtual void InitRegionEtaIndex();
+
     t_cellmap m_cells;
     std::vector< t_cellmap > m_cells_in_sampling;
     std::vector< t_eta_cellmap > m_cells_in_sampling_for_phi0;
     std::vector< std::vector< CaloGeometryLookup* > > m_cells_in_regions;
 
+    // Uniform eta grid per sampling listing, for each bin, the lookup regions whose
+    // eta range overlaps it (in the order of m_cells_in_regions). Used by getDDE to
+    // only visit candidate regions instead of looping over all regions of a sampling.
+    struct RegionEtaIndex {
+      float mineta=0;
+      float inv_deta=0;
+      std::vector< unsigned int > first; // offsets into regions, one per bin plus one
+      std::vector< unsigned int > regions;
+    };
+    std::vector< RegionEtaIndex > m_region_eta_index; //! rebuilt in PostProcessGeometry
+
     std::vector< bool > m_isCaloBarrel;
     std::vector< double > m_min_eta_sample[2]; //[side][calosample]
     std::vector< double > m_max_eta_sample[2]; //[side][calosample]
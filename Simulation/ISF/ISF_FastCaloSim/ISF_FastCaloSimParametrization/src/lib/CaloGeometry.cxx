@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2024 CERN for the benefit of the ATLAS collaboration
 */
 
 #include "ISF_FastCaloSimParametrization/CaloGeometry.h"
@@ -11,6 +11,7 @@
 #include <TGraphErrors.h>
 #include <TVector3.h>
 #include <TLegend.h>
+#include <algorithm>
 #include <fstream>
 #include <sstream>
 
@@ -38,7 +39,7 @@ const int CaloGeometry::MAX_SAMPLING = CaloCell_ID_FCS::MaxSample; //number of c
 const Identifier CaloGeometry::m_debug_identify;
 std::atomic<bool> CaloGeometry::m_debug=false;
 
-CaloGeometry::CaloGeometry() : m_cells_in_sampling(MAX_SAMPLING),m_cells_in_sampling_for_phi0(MAX_SAMPLING),m_cells_in_regions(MAX_SAMPLING),m_isCaloBarrel(MAX_SAMPLING),m_dographs(false),m_FCal_ChannelMap(0)
+CaloGeometry::CaloGeometry() : m_cells_in_sampling(MAX_SAMPLING),m_cells_in_sampling_for_phi0(MAX_SAMPLING),m_cells_in_regions(MAX_SAMPLING),m_region_eta_index(MAX_SAMPLING),m_isCaloBarrel(MAX_SAMPLING),m_dographs(false),m_FCal_ChannelMap(0)
 {
   //TMVA::Tools::Instance();
   for(int i=0;i<2;++i) {
@@ -488,8 +489,22 @@ const CaloDetDescrElement* CaloGeometry::getDDE(int sampling,float eta,float phi
    else beststeps=0;
   
   if(sampling<21) {
+    const RegionEtaIndex& index=m_region_eta_index[sampling];
     for(int skip_range_check=0;skip_range_check<=1;++skip_range_check) {
-      for(unsigned int j=0;j<m_cells_in_regions[sampling].size();++j) {
+      unsigned int kbegin=0;
+      unsigned int kend=m_cells_in_regions[sampling].size();
+      const unsigned int* regions=nullptr;
+      if(!skip_range_check && !index.first.empty()) {
+        // only regions overlapping the eta bin of the hit can pass the range check below
+        const float x=(eta-index.mineta)*index.inv_deta;
+        if(!(x>=0 && x<index.first.size()-1)) continue;
+        const unsigned int bin=x;
+        kbegin=index.first[bin];
+        kend=index.first[bin+1];
+        regions=index.regions.data();
+      }
+      for(unsigned int k=kbegin;k<kend;++k) {
+        const unsigned int j=regions ? regions[k] : k;
         if(!skip_range_check) {
           if(eta<m_cells_in_regions[sampling][j]->mineta()) continue;
           if(eta>m_cells_in_regions[sampling][j]->maxeta()) continue;
@@ -624,6 +639,45 @@ bool CaloGeometry::getClosestFCalCellIndex(int sampling,float x,float y,int& iet
   return i<nmax;
 }
 
+void CaloGeometry::InitRegionEtaIndex()
+{
+  const unsigned int nbins_per_sampling=256;
+  for(int sampling=0;sampling<MAX_SAMPLING;++sampling) {
+    RegionEtaIndex& index=m_region_eta_index[sampling];
+    index=RegionEtaIndex();
+    const std::vector< CaloGeometryLookup* >& lookups=m_cells_in_regions[sampling];
+    if(sampling>=21 || lookups.empty()) continue;
+
+    float mineta=+1000;
+    float maxeta=-1000;
+    for(const CaloGeometryLookup* lookup : lookups) {
+      mineta=std::min(mineta,lookup->mineta());
+      maxeta=std::max(maxeta,lookup->maxeta());
+    }
+    if(!(maxeta>mineta)) continue;
+
+    // one extra bin so that eta==maxeta still falls inside the grid
+    const unsigned int nbins=nbins_per_sampling+1;
+    index.mineta=mineta;
+    index.inv_deta=nbins_per_sampling/(maxeta-mineta);
+
+    // regions are widened by one bin on each side to stay safe against rounding at bin edges
+    std::vector< std::vector< unsigned int > > bins(nbins);
+    for(unsigned int j=0;j<lookups.size();++j) {
+      const int lo=std::max(0,(int)TMath::Floor((lookups[j]->mineta()-mineta)*index.inv_deta)-1);
+      const int hi=std::min((int)nbins-1,(int)TMath::Floor((lookups[j]->maxeta()-mineta)*index.inv_deta)+1);
+      for(int bin=lo;bin<=hi;++bin) bins[bin].push_back(j);
+    }
+
+    index.first.reserve(nbins+1);
+    index.first.push_back(0);
+    for(const std::vector< unsigned int >& bin : bins) {
+      index.regions.insert(index.regions.end(),bin.begin(),bin.end());
+      index.first.push_back(index.regions.size());
+    }
+  }
+}
+
 bool CaloGeometry::PostProcessGeometry()
 {
   for(int i=0;i<MAX_SAMPLING;++i) {
@@ -635,6 +689,7 @@ bool CaloGeometry::PostProcessGeometry()
   }
   
   InitRZmaps(); 
+  InitRegionEtaIndex();
   
   /*
   cout<<"all : "<<m_cells.size()<<endl;
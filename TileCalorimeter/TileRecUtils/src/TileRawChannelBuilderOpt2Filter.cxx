@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2024 CERN for the benefit of the ATLAS collaboration
 */
 
 
@@ -510,6 +510,7 @@ int TileRawChannelBuilderOpt2Filter::iterate(int ros, int drawer, int channel, i
   int nIterations = 0;
   double savePhase = 0.0;
   double phase = 0.0;
+  double requestedPhase = 0.0;
   time = -1000.;
   
   // Mythic -1 iteration or DSP emulation case
@@ -521,6 +522,12 @@ int TileRawChannelBuilderOpt2Filter::iterate(int ros, int drawer, int channel, i
           || m_emulateDsp)
          && nIterations < m_maxIterations) {
 
+    // compute() only depends on the requested phase: once the phase does not move any more
+    // (typical with DSP emulation, where the phase is rounded), further iterations
+    // would only repeat the OFC retrieval and give the same result
+    if (nIterations > 0 && phase == requestedPhase) break;
+    requestedPhase = phase;
+
     chi2 = compute(ros, drawer, channel, gain, pedestal, amplitude, time, phase, ctx);
 
     savePhase = phase;
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2024 CERN for the benefit of the ATLAS collaboration
 */
 
 //-----------------------------------------------------------------------------
@@ -15,6 +15,8 @@
 #include "TrackCollectionCnv.h"
 
 #include "GaudiKernel/IToolSvc.h"
+#include "GaudiKernel/ToolHandle.h"
+#include "TrkEventCnvTools/IEventCnvSuperTool.h"
 #include "StoreGate/StoreGateSvc.h"
 #include "AtlasDetDescr/AtlasDetectorID.h"
 
@@ -74,6 +76,24 @@ void TrackCollectionCnv::initializeOldExtConverters()
 
 
 
+void TrackCollectionCnv::initializeCovarianceCompression( MsgStream& log )
+{
+   if( m_covCompressionInitialized )  return;
+   m_covCompressionInitialized = true;
+
+   // Covariance compression for output is configured on the EventCnvSuperTool;
+   // without it the covariances are written at full precision
+   ToolHandle<Trk::IEventCnvSuperTool> eventCnvTool( "Trk::EventCnvSuperTool/EventCnvSuperTool" );
+   if( eventCnvTool.retrieve().isFailure() ) {
+      log << MSG::DEBUG << "Could not retrieve EventCnvSuperTool, track parameter covariances are written at full precision" << endmsg;
+      return;
+   }
+   m_TPConverter.setCovarianceCompression( eventCnvTool->covarianceDiagBits(),
+                                           eventCnvTool->covarianceOffDiagBits() );
+}
+
+
+
 TrackCollection_PERS * TrackCollectionCnv::createPersistentWithKey( TrackCollection *transCont,
                                                                     const std::string& key)
 {
@@ -84,6 +104,7 @@ TrackCollection_PERS * TrackCollectionCnv::createPersistentWithKey( TrackCollect
 
     MsgStream log (m_msgSvc, logname );
 
+    initializeCovarianceCompression( log );
     return m_TPConverter.createPersistentWithKey ( transCont, key, log );
 }
 
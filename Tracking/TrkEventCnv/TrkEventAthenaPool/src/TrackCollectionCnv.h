@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2024 CERN for the benefit of the ATLAS collaboration
 */
 
 //-----------------------------------------------------------------------------
@@ -62,10 +62,12 @@ protected:
 
 private: 
   void    initializeOldExtConverters();  //!< setup old extended converters when reading old data
+  void    initializeCovarianceCompression( MsgStream& log );  //!< pass the output covariance precision to the converter, on first write
     
   IMessageSvc*              m_msgSvc;
   MsgStream                 m_log;
   bool                      m_oldExtCnvInitialized = false;
+  bool                      m_covCompressionInitialized = false;
   
   TrackCollectionCnv_tlp1   m_TPConverter_tlp1;
   TrackCollectionCnv_tlp2   m_TPConverter_tlp2;
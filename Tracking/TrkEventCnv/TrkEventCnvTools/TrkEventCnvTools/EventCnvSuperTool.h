@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2020 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2024 CERN for the benefit of the ATLAS collaboration
 */
 
 #ifndef TRKEVENTCNVTOOLS_EVENTCNVSUPERTOOL
@@ -61,6 +61,9 @@ class EventCnvSuperTool : public extends<AthAlgTool, IEventCnvSuperTool>
 
       virtual bool doTrackOverlay() const override {return m_doTrackOverlay;}
 
+      virtual unsigned int covarianceDiagBits() const override {return m_covDiagBits;}
+      virtual unsigned int covarianceOffDiagBits() const override {return m_covOffDiagBits;}
+
     private:
       ToolHandle<Trk::ITrkEventCnvTool>   m_idCnvTool {this, "IdCnvTool", "InDet::InDetEventCnvTool/InDetEventCnvTool", "Tool used to handle ID RoTs etc"}; //!< Tool used to handle ID RoTs etc
       ToolHandle<Trk::ITrkEventCnvTool>   m_muonCnvTool {this, "MuonCnvTool", "Muon::MuonEventCnvTool/MuonEventCnvTool", "Tool used to handle Muon RoTs etc"}; //!< Tool used to handle Muon RoTs etc
@@ -74,6 +77,9 @@ class EventCnvSuperTool : public extends<AthAlgTool, IEventCnvSuperTool>
 
       bool                                m_doTrackOverlay; //!< Property for whether track overlay is being used, in which case different PRD containers are used by the converters
 
+      unsigned int                        m_covDiagBits; //!< Property setting the mantissa bits kept for diagonal covariance elements on output
+      unsigned int                        m_covOffDiagBits; //!< Property setting the mantissa bits kept for off-diagonal covariance elements on output
+
       mutable std::atomic_int             m_errCount; //!< Current number of ERROR/WARNING messages sent to output
       int                                 m_maxErrCount; //!< Maximum number of permissable ERROR/WARNING messages sent to output.
     };
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2020 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2024 CERN for the benefit of the ATLAS collaboration
 */
 
 #ifndef TRKEVENTCNVTOOLS_IEVENTCNVSUPERTOOL
@@ -68,6 +68,12 @@ namespace Trk
 
     /** Track overlay flag*/
     virtual bool doTrackOverlay() const=0;
+
+    /** Mantissa bits kept for the diagonal of written track parameter covariances (23 = no compression)*/
+    virtual unsigned int covarianceDiagBits() const=0;
+
+    /** Mantissa bits kept for the off-diagonal of written track parameter covariances (23 = no compression)*/
+    virtual unsigned int covarianceOffDiagBits() const=0;
     
   };
 }
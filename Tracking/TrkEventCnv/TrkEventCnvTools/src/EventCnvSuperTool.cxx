@@ -23,6 +23,8 @@ Trk::EventCnvSuperTool::EventCnvSuperTool(
     m_doMuons(true),
     m_doID(true),
     m_doTrackOverlay(false),
+    m_covDiagBits(23),
+    m_covOffDiagBits(23),
     m_errCount(0),
     m_maxErrCount(10)
 {
@@ -30,6 +32,8 @@ Trk::EventCnvSuperTool::EventCnvSuperTool(
     declareProperty("DoID",m_doID, "If true (default), attempt to retrieve Inner Detector helper tool and convert ID objects.");
     declareProperty("DoTrackOverlay",m_doTrackOverlay,"If true, ID on-track conversion tools will look for background PRD collections");
     declareProperty("MaxErrorCount", m_maxErrCount, "Maximum number of errors that will be reported");
+    declareProperty("CovMatrixDiagBits", m_covDiagBits, "Mantissa bits kept for diagonal elements of written TrackParameters covariances (23 = full float precision)");
+    declareProperty("CovMatrixOffDiagBits", m_covOffDiagBits, "Mantissa bits kept for off-diagonal elements of written TrackParameters covariances (23 = full float precision)");
 }
 
 Trk::EventCnvSuperTool::~EventCnvSuperTool(){
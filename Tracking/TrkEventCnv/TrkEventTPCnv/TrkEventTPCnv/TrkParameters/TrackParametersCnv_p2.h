@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2024 CERN for the benefit of the ATLAS collaboration
 */
 
 //-----------------------------------------------------------------------------
@@ -32,9 +32,16 @@ public:
   TrackParametersCnv_p2(bool nosurf = false)
     : m_emConverter(0),
       m_eventCnvTool("Trk::EventCnvSuperTool/EventCnvSuperTool"),
-      m_nosurf (nosurf)
+      m_nosurf (nosurf),
+      m_covDiagBits (23),
+      m_covOffDiagBits (23)
   {}
 
+  /** Reduce the float precision of written covariances, following the xAOD TrackParticle compression.
+      23 mantissa bits (the default) keeps full precision. Typically set from the EventCnvSuperTool.*/
+  void setCovarianceCompression( unsigned int diagBits, unsigned int offDiagBits )
+  { m_covDiagBits = diagBits; m_covOffDiagBits = offDiagBits; }
+
   void persToTrans( const Trk :: TrackParameters_p2 *persObj,
     Trk :: TrackParameters    *transObj,
     MsgStream &log );
@@ -60,10 +67,13 @@ private:
   static void                fillPersSurface( const Trk :: TrackParameters    *transObj, Trk :: TrackParameters_p2 *persObj, MsgStream& log);
   static void                convertTransCurvilinearToPers(const Trk :: TrackParameters    *transObj, Trk :: TrackParameters_p2 *persObj) ;
   static bool                isPersistifiableType(const Trk :: TrackParameters    *transObj) ;
+  void                       compressCovariance(std::vector<float>& values) const;
   
   ErrorMatrixCnv_p1 *                        m_emConverter;
   ToolHandle<Trk::IEventCnvSuperTool>        m_eventCnvTool;  
   bool                                       m_nosurf;
+  unsigned int                               m_covDiagBits;
+  unsigned int                               m_covOffDiagBits;
 };
 
 #endif // TRACK_PARAMETERS_CNV_P2_H
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2024 CERN for the benefit of the ATLAS collaboration
 */
 
 //-----------------------------------------------------------------------------
@@ -25,7 +25,9 @@
 #include "TrkEventTPCnv/helpers/EigenHelpers.h"
 #include "TrkEventTPCnv/helpers/CLHEPHelpers.h"
 #include "EventPrimitives/EventPrimitivesHelpers.h"
+#include "CxxUtils/FloatCompressor.h"
 
+#include <algorithm>
 #include <cassert>
 #include <iostream>
 //static bool debug=false;
@@ -193,6 +195,7 @@ void TrackParametersCnv_p2::transToPers( const Trk :: TrackParameters    *transO
   if (transObj->covariance()){
     Trk::ErrorMatrix pMat;
     EigenHelpers::eigenMatrixToVector(pMat.values, *transObj->covariance(), "TrackParametersCnv_p2");
+    if (m_covDiagBits < 23 || m_covOffDiagBits < 23) compressCovariance(pMat.values);
     persObj->m_errorMatrix = toPersistent( &m_emConverter, &pMat, log );
   }
 
@@ -211,6 +214,28 @@ void TrackParametersCnv_p2::convertTransCurvilinearToPers(const Trk :: TrackPara
   persObj->m_parameters[6] = transObj->charge();
 }
 
+void TrackParametersCnv_p2::compressCovariance(std::vector<float>& values) const {
+  // values holds the lower triangle, row by row: element (i,i) is the last of row i
+  const std::vector<float> original = values;
+  const CxxUtils::FloatCompressor diagCompressor(m_covDiagBits);
+  const unsigned int maxOffDiagBits = std::max(m_covDiagBits, m_covOffDiagBits);
+  for (unsigned int offDiagBits = m_covOffDiagBits; offDiagBits <= maxOffDiagBits; ++offDiagBits) {
+    const CxxUtils::FloatCompressor offDiagCompressor(offDiagBits);
+    unsigned int index = 0;
+    for (unsigned int i = 0; i < 5; ++i) {
+      for (unsigned int j = 0; j <= i; ++j, ++index) {
+        values[index] = (i == j ? diagCompressor : offDiagCompressor).reduceFloatPrecision(original[index]);
+      }
+    }
+    // As for xAOD::TrackParticle: check the matrix and its inverse are still positive
+    // definite, otherwise give back some off-diagonal precision
+    AmgSymMatrix(5) cov;
+    Amg::expand(values.cbegin(), values.cend(), cov);
+    if (cov.determinant() > 0. && cov.inverse().determinant() > 0.) return;
+  }
+  values = original;
+}
+
 bool TrackParametersCnv_p2::isPersistifiableType(const Trk :: TrackParameters    *transObj) {
   const Trk::Surface* surf = transObj->associatedSurface ().baseSurface();
   assert (surf);
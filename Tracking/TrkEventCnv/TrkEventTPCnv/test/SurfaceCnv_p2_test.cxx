@@ -50,6 +50,10 @@ public:
   { std::abort(); }
   virtual bool doTrackOverlay() const override
   { std::abort(); }
+  virtual unsigned int covarianceDiagBits() const override
+  { std::abort(); }
+  virtual unsigned int covarianceOffDiagBits() const override
+  { std::abort(); }
 
   virtual const Trk::Surface* getSurface(const Identifier& id) const override;
   void addSurface (std::unique_ptr<Trk::Surface> surf);
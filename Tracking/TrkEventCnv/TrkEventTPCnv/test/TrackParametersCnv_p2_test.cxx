@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2020 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2024 CERN for the benefit of the ATLAS collaboration
 */
 /**
  * @file TrkEventTPCnv/test/TrackParametersCnv_p2_test.cxx
@@ -17,7 +17,9 @@
 #include "TestTools/leakcheck.h"
 #include "CxxUtils/checker_macros.h"
 #include <cassert>
+#include <cmath>
 #include <iostream>
+#include <memory>
 
 
 void compare (const Trk::TrackParameters& p1,
@@ -132,8 +134,70 @@ void test1 ATLAS_NOT_THREAD_SAFE ()
 }
 
 
+// Round trip with reduced covariance precision.
+void test2 ATLAS_NOT_THREAD_SAFE ()
+{
+  std::cout << "test2\n";
+  Athena_test::Leakcheck check;
+
+  // A realistic (positive definite, strongly correlated) perigee covariance
+  const double sigma[5] = { 0.02, 0.05, 1e-4, 1e-4, 1e-6 };
+  const double rho[5][5] = { {  1.,   0.1,  -0.8,  0.05,  0.6 },
+                             {  0.1,  1.,    0.05, -0.7, -0.1 },
+                             { -0.8,  0.05,  1.,   -0.05, -0.5 },
+                             {  0.05, -0.7, -0.05,  1.,   0.05 },
+                             {  0.6, -0.1,  -0.5,   0.05,  1.  } };
+  AmgSymMatrix(5) cov;
+  for (int i=0; i < 5; i++)
+    for (int j=0; j < 5; j++)
+      cov(i,j) = rho[i][j] * sigma[i] * sigma[j];
+  assert (cov.llt().info() == Eigen::Success);
+
+  MsgStream log (nullptr, "test");
+  Trk::PerigeeSurface psurf (Amg::Vector3D (50, 100, 150));
+  Trk::Perigee trans1 (0.1, 20, 1.5, 0.5, 1e-3, psurf, cov);
+
+  const int diagBits = 12;
+  const int offDiagBits = 8;
+  TrackParametersCnv_p2 cnv;
+  TrackCollectionCnv_tlp5 tlcnv;
+  cnv.setRuntimeTopConverter (&tlcnv);
+  cnv.setCovarianceCompression (diagBits, offDiagBits);
+  Trk::TrackParameters_p2 pers;
+  cnv.transToPers (&trans1, &pers, log);
+  std::unique_ptr<Trk::TrackParameters> trans2 (cnv.createTransient (&pers, log));
+
+  for (int i = 0; i < 5; i++)
+    assert (Athena_test::isEqual (trans1.parameters()[i], trans2->parameters()[i]));
+  const AmgSymMatrix(5)& cov2 = *trans2->covariance();
+  bool changed = false;
+  for (int i=0; i < 5; i++) {
+    for (int j=0; j < 5; j++) {
+      assert (cov2(i,j) == cov2(j,i));
+      // the off-diagonal precision may have been increased, never decreased
+      const int bits = (i == j ? diagBits : offDiagBits);
+      assert (std::abs (cov2(i,j) - cov(i,j)) <= std::abs (cov(i,j)) * std::ldexp (1., -bits));
+      if (static_cast<float>(cov(i,j)) != static_cast<float>(cov2(i,j))) changed = true;
+    }
+  }
+  assert (changed);
+  assert (cov2.llt().info() == Eigen::Success);
+  assert (cov2.inverse().llt().info() == Eigen::Success);
+
+  // Full precision leaves the matrix as written before
+  cnv.setCovarianceCompression (23, 23);
+  Trk::TrackParameters_p2 pers3;
+  cnv.transToPers (&trans1, &pers3, log);
+  std::unique_ptr<Trk::TrackParameters> trans3 (cnv.createTransient (&pers3, log));
+  for (int i=0; i < 5; i++)
+    for (int j=0; j < 5; j++)
+      assert (trans3->covariance()->coeff(i,j) == static_cast<float>(cov(i,j)));
+}
+
+
 int main ATLAS_NOT_THREAD_SAFE ()
 {
   test1();
+  test2();
   return 0;
 }
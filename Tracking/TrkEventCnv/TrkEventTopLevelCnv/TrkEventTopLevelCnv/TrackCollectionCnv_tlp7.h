@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2022 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2024 CERN for the benefit of the ATLAS collaboration
 */
 
 #ifndef TRACK_COLLECTION_CNV_TLP7_TRK_H
@@ -59,6 +59,10 @@ class TrackCollectionCnv_tlp7 : public BaseTrackCollectionCnv_tlp7
                                         const std::string& key,
                                         MsgStream &log) override;
 
+  /// Precision reduction applied to written TrackParameters covariances
+  void setCovarianceCompression( unsigned int diagBits, unsigned int offDiagBits )
+  { m_parametersCnv.setCovarianceCompression( diagBits, offDiagBits ); }
+
 // all TP converters for types used in the Track package
 protected:
   TrackCnv_p4                       m_tracksCnv;
@@ -1,5 +1,5 @@
 /*
-   Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration
+   Copyright (C) 2002-2024 CERN for the benefit of the ATLAS collaboration
  */
 
 ///////////////////////////////////////////////////////////////////
@@ -32,11 +32,15 @@
 #include "AthenaBaseComps/AthAlgTool.h"
 #include "AthenaBaseComps/AthCheckedComponent.h"
 #include "GaudiKernel/ToolHandle.h"
+#include "AthenaKernel/SlotSpecificObj.h"
+#include "StoreGate/ReadCondHandleKey.h"
+#include "CxxUtils/checker_macros.h"
 #include <Gaudi/Accumulators.h>
 // STL
 #include <cstring>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <utility>
 #include <vector>
 
@@ -588,6 +592,19 @@ private:
   /** For the output - global position */
   std::string positionOutput(const Amg::Vector3D& pos) const;
 
+  /** The static volume navigation table of the event slot, nullptr if not in use.
+      Must be called with the mutex of the slot held. */
+  StaticNavigationTable* staticNavigationTable(const EventContext& ctx, Cache& cache) const;
+
+  /** Set the navigation of a new static volume from the slot table, returns false if not known yet */
+  bool restoreStaticNavigation(const EventContext& ctx,
+                               Cache& cache,
+                               const Trk::TrackingVolume* staticVol,
+                               bool resolveActive) const;
+
+  /** Add the navigation just resolved for the current static volume to the slot table */
+  void storeStaticNavigation(const EventContext& ctx, Cache& cache, bool resolveActive) const;
+
   /** helper method for MaterialEffectsOnTrack to be added */
   void addMaterialEffectsOnTrack(const EventContext& ctx,
                                  Cache& cache,
@@ -679,6 +696,16 @@ private:
   unsigned int m_maxNavigSurf;
   unsigned int m_maxNavigVol;
   bool m_dumpCache;
+  bool m_cacheStaticNavigation; //!< keep the navigation resolved per static volume across calls
+  //------------ Static volume navigation table per event slot
+  SG::ReadCondHandleKey<TrackingGeometry> m_staticNavigationGeometryKey{
+    this,
+    "StaticNavigationGeometryKey",
+    "",
+    "TrackingGeometry used by the Navigator; if empty, the static navigation table is only kept within an event"
+  };
+  mutable SG::SlotSpecificObj<std::mutex> m_staticNavigationMutex ATLAS_THREAD_SAFE;
+  mutable SG::SlotSpecificObj<StaticNavigationTable> m_staticNavigation ATLAS_THREAD_SAFE; // Guarded by m_staticNavigationMutex
   //------------ Magnetic field properties
   bool m_fastField;
   Trk::MagneticFieldProperties m_fieldProperties;
@@ -1,5 +1,5 @@
 /*
-   Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration
+   Copyright (C) 2002-2024 CERN for the benefit of the ATLAS collaboration
  */
  
 #ifndef TRKEXTOOLS_LOCALEXCACHE_H
@@ -10,6 +10,9 @@
 #include "TrkExInterfaces/IMaterialEffectsUpdator.h"
 #include "TrkGeometry/TrackingGeometry.h" //because of m_trackingGeometry-> in header
 #include "TrkExInterfaces/INavigator.h"  //using navigator. in this header
+#include "GaudiKernel/EventContext.h"
+#include "GaudiKernel/EventIDRange.h"
+#include <map>
 #include <utility>
 #include <vector>
 #include <string>
@@ -24,6 +27,31 @@
  }
  
 namespace Trk{
+  /** Navigation objects collected on entry into a static volume.
+      They only depend on the geometry and the Extrapolator configuration.*/
+  struct StaticVolumeNavigation
+  {
+    using DestSurf = std::pair<const Surface*, BoundaryCheck>;
+    std::vector<DestSurf> staticBoundaries;
+    std::vector<DestSurf> detachedBoundaries;
+    std::vector<DestSurf> denseBoundaries;
+    std::vector<DestSurf> layers;
+    std::vector<std::pair<const Trk::DetachedTrackingVolume*, unsigned int>> detachedVols;
+    std::vector<std::pair<const Trk::TrackingVolume*, unsigned int>> denseVols;
+    std::vector<std::pair<const Trk::TrackingVolume*, const Trk::Layer*>> navigLays;
+  };
+
+  /** Navigation resolved per static volume, kept per event slot.
+      It is valid for one TrackingGeometry conditions object, identified by
+      its IOV, or for a single event if the IOV is not known.*/
+  struct StaticNavigationTable
+  {
+    const TrackingGeometry* geometry = nullptr;
+    EventIDRange range;
+    EventContext::ContextEvt_t event = EventContext::INVALID_CONTEXT_EVT;
+    std::map<std::pair<const TrackingVolume*, bool>, StaticVolumeNavigation> volumes;
+  };
+
 struct Cache
   {
     using TrackParmContainer = ObjContainer<Trk::TrackParameters>;
@@ -74,6 +102,8 @@ struct Cache
     std::unique_ptr<identifiedParameters_t> m_identifiedParameters;
 
     const Trk::TrackingGeometry *m_trackingGeometry = nullptr;
+    //!< slot table of static volume navigation, resolved on first use
+    StaticNavigationTable *m_staticNavigation = nullptr;
     double m_path{};
 
     std::pair<unsigned int, unsigned int> m_denseResolved;
@@ -166,6 +196,14 @@ struct Cache
     ///Insert navigation surfaces from layers, dense boundaries, navig boundaries and detached boundaries
     void
     copyToNavigationSurfaces();
+
+    ///Save the navigation resolved for the current static volume
+    void
+    storeStaticNavigation(StaticVolumeNavigation& nav) const;
+
+    ///Set the navigation of the current static volume from a previously stored one
+    void
+    restoreStaticNavigation(const StaticVolumeNavigation& nav);
   };
   }
   #endif
@@ -49,6 +49,8 @@
 //
 #include "EventPrimitives/EventPrimitives.h"
 #include "GeoPrimitives/GeoPrimitives.h"
+
+#include "StoreGate/ReadCondHandle.h"
 //
 #include <memory>
 #include <utility>
@@ -146,6 +148,7 @@ Trk::Extrapolator::Extrapolator(const std::string& t, const std::string& n, cons
   , m_maxNavigSurf{ 1000 }
   , m_maxNavigVol{ 50 }
   , m_dumpCache(false)
+  , m_cacheStaticNavigation(false)
   , m_fastField(false)
   , m_referenceSurface{ nullptr }
   , m_printRzOutput(true)
@@ -205,6 +208,7 @@ Trk::Extrapolator::Extrapolator(const std::string& t, const std::string& n, cons
   declareProperty("ExtendedLayerSearch", m_extendedLayerSearch);
   declareProperty("InitialLayerAttempts", m_initialLayerAttempts);
   declareProperty("SuccessiveLayerAttempts", m_successiveLayerAttempts);
+  declareProperty("CacheStaticNavigation", m_cacheStaticNavigation);
   // debug and validation
   declareProperty("positionOutput", m_printRzOutput);
   declareProperty("NavigationStatisticsOutput", m_navigationStatistics);
@@ -260,6 +264,8 @@ Trk::Extrapolator::initialize()
 
   // Get the Navigation AlgTools
   ATH_CHECK(m_navigator.retrieve());
+  ATH_CHECK(m_staticNavigationGeometryKey.initialize(m_cacheStaticNavigation &&
+                                                     !m_staticNavigationGeometryKey.empty()));
 
   // Get the Material Updator
   if (m_includeMaterialEffects && not m_updaters.empty()) {
@@ -643,7 +649,8 @@ Trk::Extrapolator::extrapolateToNextMaterialLayer(const EventContext& ctx,
   }
 
   // update if new static volume
-  if (staticVol && (staticVol != cache.m_currentStatic || resolveActive != m_resolveActive)) {
+  if (staticVol && (staticVol != cache.m_currentStatic || resolveActive != m_resolveActive) &&
+      !restoreStaticNavigation(ctx, cache, staticVol, resolveActive)) {
     // retrieve boundaries
     cache.m_currentStatic = staticVol;
     cache.retrieveBoundaries();
@@ -722,6 +729,7 @@ Trk::Extrapolator::extrapolateToNextMaterialLayer(const EventContext& ctx,
     cache.m_denseResolved = std::pair<unsigned int, unsigned int>(cache.m_denseVols.size(),
                                                                   cache.m_denseBoundaries.size());
     cache.m_layerResolved = cache.m_layers.size();
+    storeStaticNavigation(ctx, cache, resolveActive);
   }
 
   cache.m_navigSurfs.insert(
@@ -4337,6 +4345,79 @@ Trk::Extrapolator::positionOutput(const Amg::Vector3D& pos) const
   return outStream.str();
 }
 
+Trk::StaticNavigationTable*
+Trk::Extrapolator::staticNavigationTable(const EventContext& ctx, Cache& cache) const
+{
+  if (!m_cacheStaticNavigation || !cache.m_trackingGeometry) {
+    return nullptr;
+  }
+  if (cache.m_staticNavigation) {
+    return cache.m_staticNavigation;
+  }
+  StaticNavigationTable* table = m_staticNavigation.get(ctx);
+  bool valid = (table->geometry == cache.m_trackingGeometry);
+  if (m_staticNavigationGeometryKey.empty()) {
+    // without the IOV of the geometry the table can only be trusted within
+    // one event: a conditions object may be freed and another one created
+    // at the same address between events
+    valid = valid && table->event == ctx.evt();
+  } else {
+    SG::ReadCondHandle<TrackingGeometry> geometry(m_staticNavigationGeometryKey, ctx);
+    if (!geometry.isValid() || geometry.cptr() != cache.m_trackingGeometry) {
+      // not the geometry the Navigator hands out, do not cache
+      return nullptr;
+    }
+    const EventIDRange& range = geometry.getRange();
+    valid = valid && table->range.start() == range.start() && table->range.stop() == range.stop();
+    table->range = range;
+  }
+  if (!valid) {
+    table->volumes.clear();
+    table->geometry = cache.m_trackingGeometry;
+  }
+  table->event = ctx.evt();
+  cache.m_staticNavigation = table;
+  return table;
+}
+
+bool
+Trk::Extrapolator::restoreStaticNavigation(const EventContext& ctx,
+                                           Cache& cache,
+                                           const Trk::TrackingVolume* staticVol,
+                                           bool resolveActive) const
+{
+  if (!m_cacheStaticNavigation) {
+    return false;
+  }
+  // algorithms of the same event share the slot table
+  std::lock_guard<std::mutex> lock(*m_staticNavigationMutex.get(ctx));
+  const StaticNavigationTable* table = staticNavigationTable(ctx, cache);
+  if (!table) {
+    return false;
+  }
+  const auto nav = table->volumes.find(std::make_pair(staticVol, resolveActive));
+  if (nav == table->volumes.end()) {
+    return false;
+  }
+  cache.m_currentStatic = staticVol;
+  cache.restoreStaticNavigation(nav->second);
+  return true;
+}
+
+void
+Trk::Extrapolator::storeStaticNavigation(const EventContext& ctx, Cache& cache, bool resolveActive) const
+{
+  if (!m_cacheStaticNavigation) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(*m_staticNavigationMutex.get(ctx));
+  StaticNavigationTable* table = staticNavigationTable(ctx, cache);
+  if (!table) {
+    return;
+  }
+  cache.storeStaticNavigation(table->volumes[std::make_pair(cache.m_currentStatic, resolveActive)]);
+}
+
 void
 Trk::Extrapolator::addMaterialEffectsOnTrack(const EventContext& ctx,
                                              Cache& cache,
@@ -4656,7 +4737,8 @@ Trk::Extrapolator::extrapolateToVolumeWithPathLimit(const EventContext& ctx,
   }
 
   // update if new static volume
-  if (updateStatic) { // retrieve boundaries
+  if (updateStatic && !restoreStaticNavigation(ctx, cache, cache.m_currentStatic, true)) {
+    // retrieve boundaries
     cache.retrieveBoundaries();
     //
     cache.m_detachedVols.clear();
@@ -4717,6 +4799,7 @@ Trk::Extrapolator::extrapolateToVolumeWithPathLimit(const EventContext& ctx,
     cache.m_denseResolved = std::pair<unsigned int, unsigned int>(cache.m_denseVols.size(),
                                                                   cache.m_denseBoundaries.size());
     cache.m_layerResolved = cache.m_layers.size();
+    storeStaticNavigation(ctx, cache, true);
   }
 
   cache.m_navigSurfs.insert(
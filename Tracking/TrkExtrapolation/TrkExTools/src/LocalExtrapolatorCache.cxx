@@ -1,5 +1,5 @@
 /*
-   Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration
+   Copyright (C) 2002-2024 CERN for the benefit of the ATLAS collaboration
  */
 #include "TrkSurfaces/Surface.h"
 #include "TrkExUtils/ExtrapolationCache.h" 
@@ -134,5 +134,29 @@ namespace Trk{
     }
   }
 
+  void
+  Cache::storeStaticNavigation(StaticVolumeNavigation& nav) const{
+    nav.staticBoundaries = m_staticBoundaries;
+    nav.detachedBoundaries = m_detachedBoundaries;
+    nav.denseBoundaries = m_denseBoundaries;
+    nav.layers = m_layers;
+    nav.detachedVols = m_detachedVols;
+    nav.denseVols = m_denseVols;
+    nav.navigLays = m_navigLays;
+  }
+
+  void
+  Cache::restoreStaticNavigation(const StaticVolumeNavigation& nav){
+    m_staticBoundaries = nav.staticBoundaries;
+    m_detachedBoundaries = nav.detachedBoundaries;
+    m_denseBoundaries = nav.denseBoundaries;
+    m_layers = nav.layers;
+    m_detachedVols = nav.detachedVols;
+    m_denseVols = nav.denseVols;
+    m_navigLays = nav.navigLays;
+    m_denseResolved = std::pair<unsigned int, unsigned int>(m_denseVols.size(), m_denseBoundaries.size());
+    m_layerResolved = m_layers.size();
+  }
+
 
 }
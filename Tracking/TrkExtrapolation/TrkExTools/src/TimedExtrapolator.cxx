@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2023 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2024 CERN for the benefit of the ATLAS collaboration
 */
 
 ///////////////////////////////////////////////////////////////////
@@ -1445,6 +1445,8 @@ Trk::TimedExtrapolator::transportToVolumeWithPathLimit(
   // initialize the return parameters vector
   std::unique_ptr<const Trk::TrackParameters> returnParameters = nullptr;
   const Trk::TrackParameters *currPar = &parm;
+  // direction of flight - neutral transport is a straight line from parm
+  const Amg::Vector3D travelDir = dir * parm.momentum().normalized();
   const Trk::TrackingVolume *currVol = nullptr;
   const Trk::TrackingVolume *nextVol = nullptr;
   const Trk::TrackingVolume *assocVol = nullptr;
@@ -1477,10 +1479,10 @@ Trk::TimedExtrapolator::transportToVolumeWithPathLimit(
       for (unsigned int ib = 0; ib < bounds.size(); ib++) {
         const Trk::Surface &surf = (bounds[ib])->surfaceRepresentation();
         Trk::DistanceSolution distSol = surf.straightLineDistanceEstimate(currPar->position(),
-                                                                          dir * currPar->momentum().normalized());
+                                                                          travelDir);
         if (distSol.numberOfSolutions() > 0 && distSol.first() > 0.) {
           // boundary check
-          Amg::Vector3D gp = currPar->position() + distSol.first() * dir * currPar->momentum().normalized();
+          Amg::Vector3D gp = currPar->position() + distSol.first() * travelDir;
           if (surf.isOnSurface(gp, true, 0.001, 0.001)) {
             iDest++;
             cache.m_trSurfs.emplace_back(&surf, distSol.first());
@@ -1488,7 +1490,7 @@ Trk::TimedExtrapolator::transportToVolumeWithPathLimit(
         }  // along path
         if (distSol.numberOfSolutions() > 1 && distSol.second() > 0.) {
           // boundary check
-          Amg::Vector3D gp = currPar->position() + distSol.second() * dir * currPar->momentum().normalized();
+          Amg::Vector3D gp = currPar->position() + distSol.second() * travelDir;
           if (surf.isOnSurface(gp, true, 0.001, 0.001)) {
             iDest++;
             cache.m_trSurfs.emplace_back(&surf, distSol.second());
@@ -1507,10 +1509,9 @@ Trk::TimedExtrapolator::transportToVolumeWithPathLimit(
       cache.m_currentStatic = m_navigator->trackingGeometry(ctx)->lowestStaticTrackingVolume(gp);
 
       if (!cache.m_currentStatic ||
-          !cache.m_currentStatic->inside(currPar->position() + 0.01 * dir * currPar->momentum().normalized(), 0.)) {
+          !cache.m_currentStatic->inside(currPar->position() + 0.01 * travelDir, 0.)) {
         cache.m_currentStatic = m_navigator->trackingGeometry(ctx)->lowestStaticTrackingVolume(currPar->position()
-                                                                                      + 0.01 * dir *
-                                                                                      currPar->momentum().normalized());
+                                                                                      + 0.01 * travelDir);
       }
     }
 
@@ -1545,7 +1546,7 @@ Trk::TimedExtrapolator::transportToVolumeWithPathLimit(
   for (unsigned int ib = 0; ib < bounds.size(); ++ib) {
     const Trk::Surface &surf = (bounds[ib])->surfaceRepresentation();
     Trk::DistanceSolution distSol = surf.straightLineDistanceEstimate(currPar->position(),
-                                                                      dir * currPar->momentum().normalized());
+                                                                      travelDir);
     if (distSol.numberOfSolutions() > 0 &&
         (distSol.currentDistance(false) > m_tolerance || distSol.numberOfSolutions() > 1) &&
         distSol.first() > m_tolerance) {
@@ -1555,7 +1556,7 @@ Trk::TimedExtrapolator::transportToVolumeWithPathLimit(
         dist = distSol.second();
       }
       // boundary check
-      Amg::Vector3D gp = currPar->position() + dist * dir * currPar->momentum().normalized();
+      Amg::Vector3D gp = currPar->position() + dist * travelDir;
       if (surf.isOnSurface(gp, true, m_tolerance, m_tolerance)) {
         cache.m_trStaticBounds.insert(cache.m_trStaticBounds.begin(), Trk::DestBound(&surf, dist, ib));
       }
@@ -1563,7 +1564,7 @@ Trk::TimedExtrapolator::transportToVolumeWithPathLimit(
     if (distSol.numberOfSolutions() > 1 && distSol.second() > m_tolerance) {
       double dist = distSol.second();
       // boundary check
-      Amg::Vector3D gp = currPar->position() + dist * dir * currPar->momentum().unit();
+      Amg::Vector3D gp = currPar->position() + dist * travelDir;
       if (surf.isOnSurface(gp, true, m_tolerance, m_tolerance)) {
         if (dist > m_tolerance) {  // valid intersection
           cache.m_trStaticBounds.insert(cache.m_trStaticBounds.begin(), Trk::DestBound(&surf, dist, ib));
@@ -1594,17 +1595,17 @@ Trk::TimedExtrapolator::transportToVolumeWithPathLimit(
     for (unsigned int ib = 0; ib < bounds.size(); ib++) {
       const Trk::Surface &surf = (bounds[ib])->surfaceRepresentation();
       Trk::DistanceSolution distSol = surf.straightLineDistanceEstimate(currPar->position(),
-                                                                        dir * currPar->momentum().unit());
+                                                                        travelDir);
       ATH_MSG_DEBUG(
         "---> decomposed boundary surface position, normal, estimated distance:" << ib << "," << surf.center() << "," <<
         surf.normal());
       ATH_MSG_DEBUG(
         "---> estimated distance to (first solution):boundary check:" << distSol.numberOfSolutions() << "," << distSol.first() << ":" <<
-                    surf.isOnSurface(currPar->position() + distSol.first() * dir * currPar->momentum().unit(), true,
+                    surf.isOnSurface(currPar->position() + distSol.first() * travelDir, true,
                                      m_tolerance, m_tolerance));
       if (distSol.numberOfSolutions() > 1) {
         ATH_MSG_DEBUG("---> estimated distance to (second solution):boundary check:" << distSol.second() << "," <<
-                      surf.isOnSurface(currPar->position() + distSol.second() * dir * currPar->momentum().unit(), true,
+                      surf.isOnSurface(currPar->position() + distSol.second() * travelDir, true,
                                        m_tolerance, m_tolerance));
       }
     }
@@ -1614,7 +1615,7 @@ Trk::TimedExtrapolator::transportToVolumeWithPathLimit(
     // TODO find out why this case (=exit from volume) haven't been handled by Navigator
     // ATH_MSG_WARNING( " recovering from glitch at the static volume boundary:"<<cache.m_trStaticBounds[0].distance );
 
-    Amg::Vector3D gp = currPar->position() + m_tolerance * dir * currPar->momentum().unit();
+    Amg::Vector3D gp = currPar->position() + m_tolerance * travelDir;
     cache.m_currentStatic = m_navigator->trackingGeometry(ctx)->lowestStaticTrackingVolume(gp);
 
     if (cache.m_currentStatic) {
@@ -1647,10 +1648,10 @@ Trk::TimedExtrapolator::transportToVolumeWithPathLimit(
         if (!m_resolveMultilayers || (*iTer)->multilayerRepresentation().empty()) {
           const Trk::Surface &surf = layR->surfaceRepresentation();
           Trk::DistanceSolution distSol = surf.straightLineDistanceEstimate(currPar->position(),
-                                                                            dir * currPar->momentum().normalized());
+                                                                            travelDir);
           if (distSol.numberOfSolutions() > 0 && distSol.first() > 0.) {
             // boundary check
-            Amg::Vector3D gp = currPar->position() + distSol.first() * dir * currPar->momentum().normalized();
+            Amg::Vector3D gp = currPar->position() + distSol.first() * travelDir;
             if (surf.isOnSurface(gp, true, 0.001, 0.001)) {
               cache.m_trLays.emplace_back(&surf, distSol.first());
               cache.m_navigLays.emplace_back((*iTer)->trackingVolume(), layR);
@@ -1661,10 +1662,10 @@ Trk::TimedExtrapolator::transportToVolumeWithPathLimit(
           for (const auto *i : multi) {
             const Trk::Surface &surf = i->surfaceRepresentation();
             Trk::DistanceSolution distSol = surf.straightLineDistanceEstimate(currPar->position(),
-                                                                              dir * currPar->momentum().normalized());
+                                                                              travelDir);
             if (distSol.numberOfSolutions() > 0 && distSol.first() > 0.) {
               // boundary check
-              Amg::Vector3D gp = currPar->position() + distSol.first() * dir * currPar->momentum().normalized();
+              Amg::Vector3D gp = currPar->position() + distSol.first() * travelDir;
               if (surf.isOnSurface(gp, true, 0.001, 0.001)) {
                 cache.m_trLays.emplace_back(&surf, distSol.first());
                 cache.m_navigLays.emplace_back((*iTer)->trackingVolume(), i);
@@ -1685,10 +1686,10 @@ Trk::TimedExtrapolator::transportToVolumeWithPathLimit(
           for (unsigned int ibb = 0; ibb < detBounds.size(); ibb++) {
             const Trk::Surface &surf = (detBounds[ibb])->surfaceRepresentation();
             Trk::DistanceSolution distSol = surf.straightLineDistanceEstimate(currPar->position(),
-                                                                              dir * currPar->momentum().normalized());
+                                                                              travelDir);
             if (distSol.numberOfSolutions() > 0 && distSol.first() > 0.) {
               // boundary check
-              Amg::Vector3D gp = currPar->position() + distSol.first() * dir * currPar->momentum().normalized();
+              Amg::Vector3D gp = currPar->position() + distSol.first() * travelDir;
               if (surf.isOnSurface(gp, true, 0.001, 0.001)) {
                 cache.m_trDenseBounds.emplace_back(&surf, distSol.first());
                 newB++;
@@ -1716,10 +1717,10 @@ Trk::TimedExtrapolator::transportToVolumeWithPathLimit(
             for (unsigned int ibb = 0; ibb < bounds.size(); ibb++) {
               const Trk::Surface &surf = (bounds[ibb])->surfaceRepresentation();
               Trk::DistanceSolution distSol = surf.straightLineDistanceEstimate(currPar->position(),
-                                                                                dir * currPar->momentum().normalized());
+                                                                                travelDir);
               if (distSol.numberOfSolutions() > 0 && distSol.first() > 0.) {
                 // boundary check
-                Amg::Vector3D gp = currPar->position() + distSol.first() * dir * currPar->momentum().normalized();
+                Amg::Vector3D gp = currPar->position() + distSol.first() * travelDir;
                 if (surf.isOnSurface(gp, true, 0.001, 0.001)) {
                   cache.m_trDenseBounds.emplace_back(&surf, distSol.first());
                   newB++;
@@ -1743,10 +1744,10 @@ Trk::TimedExtrapolator::transportToVolumeWithPathLimit(
           for (const Trk::Layer* const lIt: confLays) {
             const Trk::Surface &surf = lIt->surfaceRepresentation();
             Trk::DistanceSolution distSol = surf.straightLineDistanceEstimate(currPar->position(),
-                                                                              dir * currPar->momentum().normalized());
+                                                                              travelDir);
             if (distSol.numberOfSolutions() > 0 && distSol.first() > 0.) {
               // boundary check
-              Amg::Vector3D gp = currPar->position() + distSol.first() * dir * currPar->momentum().normalized();
+              Amg::Vector3D gp = currPar->position() + distSol.first() * travelDir;
               if (surf.isOnSurface(gp, true, 0.001, 0.001)) {
                 cache.m_trLays.emplace_back(&surf, distSol.first());
                 cache.m_navigLays.emplace_back((*iTer)->trackingVolume(), lIt);
@@ -1795,10 +1796,10 @@ Trk::TimedExtrapolator::transportToVolumeWithPathLimit(
       if (cLay->layerMaterialProperties()) {
         const Trk::Surface &surf = cLay->surfaceRepresentation();
         Trk::DistanceSolution distSol = surf.straightLineDistanceEstimate(currPar->position(),
-                                                                          dir * currPar->momentum().normalized());
+                                                                          travelDir);
         if (distSol.numberOfSolutions() > 0 && distSol.first() > 0.) {
           // boundary check
-          Amg::Vector3D gp = currPar->position() + distSol.first() * dir * currPar->momentum().normalized();
+          Amg::Vector3D gp = currPar->position() + distSol.first() * travelDir;
           if (surf.isOnSurface(gp, true, 0.001, 0.001)) {
             cache.m_trLays.emplace_back(&surf, distSol.first());
             cache.m_navigLays.emplace_back(cache.m_currentStatic,
@@ -1885,7 +1886,7 @@ Trk::TimedExtrapolator::transportToVolumeWithPathLimit(
 
     double step = cache.m_trSurfs[sol].second - dist;
 
-    Amg::Vector3D nextPos = currPar->position() + dir * currPar->momentum().normalized() * cache.m_trSurfs[sol].second;
+    Amg::Vector3D nextPos = currPar->position() + travelDir * cache.m_trSurfs[sol].second;
     // Amg::Vector3D halfStep = nextPos - 0.5*step*dir*currPar->momentum().normalized();
 
     // check missing volume boundary
@@ -1943,7 +1944,7 @@ Trk::TimedExtrapolator::transportToVolumeWithPathLimit(
         cache.m_path.updateMat(fr * mDelta, cache.m_currentDense->averageZ(), 0.);
       }
 
-      nextPos = currPar->position() + dir * currPar->momentum().normalized() * (dist + fr * step);
+      nextPos = currPar->position() + travelDir * (dist + fr * step);
 
       // process interaction only if creation of secondaries allowed
       if (cache.m_currentStatic->geometrySignature() == Trk::ID || m_caloMsSecondary) {
@@ -8,6 +8,8 @@
 #include "TrkTrack/GXFTrackState.h"
 #include "TrkGeometry/MagneticFieldProperties.h"
 
+#include <Eigen/Cholesky>
+
 /**
  * These headers, as well as other headers in the TrkGlobalChi2Fitter package
  * use modern C++11 memory ownership semantics expressed through smart
@@ -96,6 +98,22 @@ namespace Trk {
     Amg::VectorX & errors();
     Amg::MatrixX & weightedResidualDerivatives();
 
+    using Jacobians = std::vector<Eigen::Matrix<double, 5, 5>, Eigen::aligned_allocator<Eigen::Matrix<double, 5, 5>>>;
+
+    /**
+     * @brief Scratch storage used by the fitter while iterating.
+     *
+     * The scatterer and brem jacobians, the Cholesky decomposition of the
+     * weight matrix and the parameter update are recomputed on every
+     * iteration with the same dimensions, so keeping them with the
+     * trajectory avoids reallocating them each time. The contents are not
+     * part of the state of the trajectory and are not copied.
+     */
+    Jacobians & scatteringJacobians();
+    Jacobians & bremJacobians();
+    Eigen::LLT<Eigen::MatrixXd> & choleskyWorkspace();
+    Amg::VectorX & parameterUpdate();
+
     double totalX0() const;
     double totalEnergyLoss() const;
 
@@ -140,6 +158,13 @@ namespace Trk {
     Amg::VectorX m_res;
     Amg::VectorX m_errors;
     Amg::MatrixX m_weightresderiv;
+    bool m_zerores = false; //!< Residuals need to be zeroed on next access, storage is kept
+    bool m_zeroerrors = false; //!< Errors need to be zeroed on next access, storage is kept
+    bool m_zeroweightresderiv = false; //!< Derivatives need to be zeroed on next access, storage is kept
+    Jacobians m_jacscat;
+    Jacobians m_jacbrem;
+    Eigen::LLT<Eigen::MatrixXd> m_llt;
+    Amg::VectorX m_update;
     double m_totx0;
     double m_toteloss;
     double m_mass;
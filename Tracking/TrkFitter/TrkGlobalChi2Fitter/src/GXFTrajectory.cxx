@@ -72,6 +72,9 @@ namespace Trk {
       m_res (rhs.m_res),
       m_errors (rhs.m_errors),
       m_weightresderiv (rhs.m_weightresderiv),
+      m_zerores (rhs.m_zerores),
+      m_zeroerrors (rhs.m_zeroerrors),
+      m_zeroweightresderiv (rhs.m_zeroweightresderiv),
       m_totx0 (rhs.m_totx0),
       m_toteloss (rhs.m_toteloss),
       m_mass (rhs.m_mass),
@@ -130,6 +133,9 @@ namespace Trk {
       m_res = rhs.m_res;
       m_errors = rhs.m_errors;
       m_weightresderiv = rhs.m_weightresderiv;
+      m_zerores = rhs.m_zerores;
+      m_zeroerrors = rhs.m_zeroerrors;
+      m_zeroweightresderiv = rhs.m_zeroweightresderiv;
       m_totx0 = rhs.m_totx0;
       m_toteloss = rhs.m_toteloss;
       m_mass = rhs.m_mass;
@@ -410,9 +416,14 @@ namespace Trk {
   }
 
   void GXFTrajectory::reset() {
-    m_res.resize(0);
-    m_weightresderiv.resize(0, 0);
-    m_errors.resize(0);
+    /*
+     * Do not release the residual, error and derivative arrays here, the
+     * next iteration needs them again with (almost always) the same size.
+     * They are zeroed, and resized if needed, on their next access.
+     */
+    m_zerores = true;
+    m_zeroerrors = true;
+    m_zeroweightresderiv = true;
     m_scatteringangles.clear();
     m_scatteringsigmas.clear();
     m_converged = false;
@@ -593,29 +604,48 @@ namespace Trk {
   }
 
   Amg::VectorX & GXFTrajectory::residuals() {
-    if (m_res.size() == 0) {
+    if (m_res.size() == 0 || m_zerores) {
       m_res.setZero(numberOfBrems() + m_ndof + m_nperpars + m_nmeasoutl);
+      m_zerores = false;
     }
     return m_res;
   }
 
   Amg::VectorX & GXFTrajectory::errors() {
-    if (m_errors.size() == 0) {
+    if (m_errors.size() == 0 || m_zeroerrors) {
       m_errors.setZero(numberOfBrems() + m_ndof + m_nperpars + m_nmeasoutl);
+      m_zeroerrors = false;
     }
     return m_errors;
   }
 
   Amg::MatrixX & GXFTrajectory::weightedResidualDerivatives() {
-    if (m_weightresderiv.size() == 0) {
+    if (m_weightresderiv.size() == 0 || m_zeroweightresderiv) {
       m_weightresderiv.setZero(
         numberOfBrems() + m_ndof + m_nperpars + m_nmeasoutl,
         numberOfFitParameters()
       );
+      m_zeroweightresderiv = false;
     }
     return m_weightresderiv;
   }
 
+  GXFTrajectory::Jacobians & GXFTrajectory::scatteringJacobians() {
+    return m_jacscat;
+  }
+
+  GXFTrajectory::Jacobians & GXFTrajectory::bremJacobians() {
+    return m_jacbrem;
+  }
+
+  Eigen::LLT<Eigen::MatrixXd> & GXFTrajectory::choleskyWorkspace() {
+    return m_llt;
+  }
+
+  Amg::VectorX & GXFTrajectory::parameterUpdate() {
+    return m_update;
+  }
+
   double
     GXFTrajectory::totalX0() const {
     return m_totx0;
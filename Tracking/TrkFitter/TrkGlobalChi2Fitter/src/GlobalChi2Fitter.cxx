@@ -5978,13 +5978,20 @@ namespace Trk {
     int nbrem = trajectory.numberOfBrems();
     int nperparams = trajectory.numberOfPerigeeParameters();
 
-    Eigen::LLT<Eigen::MatrixXd> llt(lu_m);
-    Amg::VectorX result;
+    /*
+     * Decompose and solve in the storage kept by the trajectory, the
+     * dimensions are the same on every iteration.
+     */
+    Eigen::LLT<Eigen::MatrixXd> & llt = trajectory.choleskyWorkspace();
+    Amg::VectorX & result = trajectory.parameterUpdate();
+
+    llt.compute(lu_m);
 
     if (llt.info() == Eigen::Success) {
+      result.resize(b.size());
       result = llt.solve(b);
     } else {
-      result = Eigen::VectorXd::Zero(b.size());
+      result.setZero(b.size());
     }
 
     if (trajectory.numberOfPerigeeParameters() > 0) {
@@ -7825,8 +7832,15 @@ namespace Trk {
     
     Matrix55 jacvertex(initialjac);
     
-    std::vector<Matrix55, Eigen::aligned_allocator<Matrix55>> jacscat(trajectory.numberOfScatterers(), initialjac);
-    std::vector<Matrix55, Eigen::aligned_allocator<Matrix55>> jacbrem(trajectory.numberOfBrems(), initialjac);
+    /*
+     * The jacobians are only partially overwritten below, so they have to
+     * start from the initial value, but the storage is reused between
+     * iterations.
+     */
+    GXFTrajectory::Jacobians & jacscat = trajectory.scatteringJacobians();
+    GXFTrajectory::Jacobians & jacbrem = trajectory.bremJacobians();
+    jacscat.assign(trajectory.numberOfScatterers(), initialjac);
+    jacbrem.assign(trajectory.numberOfBrems(), initialjac);
 
     std::vector<std::unique_ptr<GXFTrackState>> & states = trajectory.trackStates();
     GXFTrackState *prevstate = nullptr, *state = nullptr;
@@ -108,6 +108,18 @@ class Track;
         const std::vector<const TrackParameters*>& list,
         Amg::Vector3D& Vertex,
         IVKalState& istate) const = 0;
+
+      /** Fast crude estimation of the two-track vertices of many track pairs at once.
+          Each pair (indices into the list) gets the same estimate as VKalVrtFitFast
+          on the two tracks alone; the per-track part of the conversion is done once.
+          pairOK is false for pairs with a track which could not be converted.
+       */
+      virtual StatusCode VKalVrtFitFastPairs(
+        const std::vector<const xAOD::TrackParticle*>& list,
+        const std::vector<std::pair<int, int>>& pairs,
+        std::vector<Amg::Vector3D>& Vertices,
+        std::vector<bool>& pairOK,
+        IVKalState& istate) const = 0;
       //.........................................................................................
 
       virtual std::unique_ptr<Perigee>
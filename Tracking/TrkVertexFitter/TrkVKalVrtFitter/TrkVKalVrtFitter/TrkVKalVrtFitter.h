@@ -232,6 +232,13 @@ namespace Trk{
           Amg::Vector3D& Vertex,
           IVKalState& istate) const override final;
 
+        virtual StatusCode VKalVrtFitFastPairs(
+          const std::vector<const xAOD::TrackParticle*>&,
+          const std::vector<std::pair<int, int>>& pairs,
+          std::vector<Amg::Vector3D>& Vertices,
+          std::vector<bool>& pairOK,
+          IVKalState& istate) const override final;
+
         virtual std::unique_ptr<Trk::Perigee>
           CreatePerigee(const std::vector<double>& VKPerigee,
                         const std::vector<double>& VKCov,
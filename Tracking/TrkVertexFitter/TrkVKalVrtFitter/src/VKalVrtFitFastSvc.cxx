@@ -8,6 +8,8 @@
 //-------------------------------------------------
 //
 #include "TrkTrack/TrackInfo.h"
+#include "TrkParameters/TrackParameters.h"
+#include <array>
 #include <vector>
 #include <algorithm> //for nth_element, max_element
 #include <cmath> //for abs
@@ -107,6 +109,89 @@ namespace Trk{
   }
 
 
+//-----------------------------------------------------------------------------------------
+//  Fast estimation of many 2-track vertices (secondary vertex pair search).
+//  Every pair is estimated exactly as VKalVrtFitFast does for the two tracks alone:
+//  reference frame in the mean of the two perigee positions and magnetic field in it.
+//  What does not depend on the pair (size check, covariance conversion and field
+//  at the perigee of every track) is done only once per track, and no new state
+//  is needed per pair.
+//
+  StatusCode TrkVKalVrtFitter::VKalVrtFitFastPairs(const std::vector<const xAOD::TrackParticle*>& InpTrk,
+                                                   const std::vector<std::pair<int,int>>& pairs,
+                                                   std::vector<Amg::Vector3D>& Vertices,
+                                                   std::vector<bool>& pairOK,
+                                                   IVKalState& istate) const
+  {
+    assert(dynamic_cast<State*> (&istate)!=nullptr);
+    State& state = static_cast<State&> (istate);
+    Vertices.assign(pairs.size(), Amg::Vector3D(0.,0.,0.));
+    pairOK.assign(pairs.size(), false);
+    if(pairs.empty()) return StatusCode::SUCCESS;
+//
+//  Per track quantities, field taken in ATLAS frame as in CvtTrackParticle
+//
+    state.m_refFrameX=state.m_refFrameY=state.m_refFrameZ=0.;
+    state.m_fitField.setAtlasMagRefFrame( 0., 0., 0.);
+    const int ntrk = InpTrk.size();
+    std::vector<char> trkOK(ntrk,0);
+    std::vector<std::array<double,15>> trkCov(ntrk);
+    std::vector<double> trkBMAG(ntrk,0.);
+    double fx,fy,BMAG_FIXED;
+    for(int i=0; i<ntrk; i++){
+      const Perigee& mPer = InpTrk[i]->perigeeParameters();
+      const Amg::Vector3D& perGlobalPos = mPer.position();
+      if(std::abs(perGlobalPos.z()) > m_IDsizeZ) continue;   // Crazy user protection
+      if(perGlobalPos.perp() > m_IDsizeR) continue;          // fails only the pairs with this track
+      if( !convertAmg5SymMtx(mPer.covariance(), trkCov[i].data()) ) continue;
+      state.m_fitField.getMagFld( perGlobalPos.x(), perGlobalPos.y(), perGlobalPos.z(), fx, fy, BMAG_FIXED);
+      if(std::abs(BMAG_FIXED) < 0.01) BMAG_FIXED=0.01;
+      trkBMAG[i]=BMAG_FIXED;
+      trkOK[i]=1;
+    }
+//
+//  Crossing point estimation per pair, in the reference frame of the pair
+//
+    double apar[2][5], awgt[15], out[3];
+    long int charge=0;
+    for(size_t ip=0; ip<pairs.size(); ip++){
+      const int trk[2]={pairs[ip].first, pairs[ip].second};
+      if(trk[0]<0 || trk[1]<0 || trk[0]>=ntrk || trk[1]>=ntrk) continue;
+      if(!trkOK[trk[0]] || !trkOK[trk[1]]) continue;
+      double refFrameX=0, refFrameY=0, refFrameZ=0;
+      for(int it : trk){
+        const Amg::Vector3D& perGlobalPos = InpTrk[it]->perigeeParameters().position();
+        refFrameX += perGlobalPos.x();
+        refFrameY += perGlobalPos.y();
+        refFrameZ += perGlobalPos.z();
+      }
+      refFrameX /= 2; refFrameY /= 2; refFrameZ /= 2;
+      PerigeeSurface surfGRefPoint( Amg::Vector3D(refFrameX, refFrameY, refFrameZ) );
+      for(int k=0; k<2; k++){
+        const Perigee& mPer = InpTrk[trk[k]]->perigeeParameters();
+        AmgSymMatrix(5) tmpCov = AmgSymMatrix(5)(*(mPer.covariance()));
+        const Perigee tmpPer(mPer.position(),mPer.momentum(),mPer.charge(),surfGRefPoint,std::move(tmpCov));
+        const AmgVector(5)& VectPerig = tmpPer.parameters();
+        VKalTransform( trkBMAG[trk[k]], VectPerig[0], VectPerig[1], VectPerig[2], VectPerig[3], VectPerig[4],
+                       trkCov[trk[k]].data(), charge, apar[k], awgt);
+      }
+      state.m_refFrameX=refFrameX;
+      state.m_refFrameY=refFrameY;
+      state.m_refFrameZ=refFrameZ;
+      state.m_fitField.setAtlasMagRefFrame( refFrameX, refFrameY, refFrameZ);
+      double BMAG_CUR;
+      state.m_fitField.getMagFld(0.,0.,0.,fx,fy,BMAG_CUR);
+      if(std::abs(BMAG_CUR) < 0.1) BMAG_CUR=0.1;
+      double xyz0[3]={ -refFrameX, -refFrameY, -refFrameZ};
+      Trk::vkvFastV(apar[0], apar[1], xyz0, BMAG_CUR, out);
+      Vertices[ip]=Amg::Vector3D(out[0]+refFrameX, out[1]+refFrameY, out[2]+refFrameZ);
+      pairOK[ip]=true;
+      state.m_fitField.setAtlasMagRefFrame( 0., 0., 0.);
+    }
+
+    return StatusCode::SUCCESS;
+  }
+
 
   StatusCode TrkVKalVrtFitter::VKalVrtFitFast(const std::vector<const TrackParameters*>& InpTrk,
                                               Amg::Vector3D& Vertex,
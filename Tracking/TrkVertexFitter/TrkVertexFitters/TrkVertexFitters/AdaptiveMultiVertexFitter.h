@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2021 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2024 CERN for the benefit of the ATLAS collaboration
 */
 
 
@@ -12,6 +12,8 @@
 
 //xAOD includes
 #include "xAODTracking/Vertex.h"
+#include <unordered_map>
+#include <utility>
 #include <vector>
 //
 #include "TrkVertexFitterInterfaces/IImpactPoint3dEstimator.h"
@@ -198,6 +200,27 @@ namespace Trk
     std::vector<double> 
     collectWeights(TrackToVtxLink & tracklink) const;
 
+    /**
+     * Compatibilities of all the track-vertex pairs of one fit iteration, per TrackToVtxLink.
+     */
+    using CompatibilityTable =
+      std::unordered_map<const TrackToVtxLink*, std::vector<std::pair<const xAOD::Vertex*, double>>>;
+
+    /**
+     * Internal function to collect in one pass the compatibilities of all the tracks of 
+     * the vertices being fit, so that the weights of a track shared by several vertices 
+     * do not require a search through the tracks of each of them.
+     */
+    static CompatibilityTable
+    collectCompatibilities(const std::vector<xAOD::Vertex*> & allVertices);
+
+    /**
+     * Same as above, using the precomputed compatibilities; falls back to the search 
+     * if the track is linked to a vertex which is not part of the table.
+     */
+    std::vector<double> 
+    collectWeights(TrackToVtxLink & tracklink, const CompatibilityTable & compatibilities) const;
+
     /**
      * Internal function to prepare the compatibility information of all the tracks of the 
      * new vertex (an IP3dAtaPlane is added, which makes later the estimation of the compatibilities 
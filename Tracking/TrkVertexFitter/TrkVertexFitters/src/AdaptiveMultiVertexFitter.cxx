@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2021 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2024 CERN for the benefit of the ATLAS collaboration
 */
 
 /***************************************************************************
@@ -19,6 +19,7 @@
 #include <algorithm> //std::find
 #include <limits>
 #include <numeric> //accumulate, reduce etc
+#include <unordered_map>
 
 namespace Trk {
 
@@ -160,6 +161,13 @@ AdaptiveMultiVertexFitter::fit(std::vector<xAOD::Vertex*>& allVertices) const
       }
     }
     ATH_MSG_DEBUG("Finished first candidates cycle");
+    // the compatibilities do not change while the weights are being computed:
+    // collect them once for all track-vertex pairs of the fit, instead of
+    // searching the tracks of every vertex a track is linked to, for every
+    // track at every vertex
+    const CompatibilityTable compatibilities = collectCompatibilities(allVertices);
+    std::unordered_map<const Trk::TrackToVtxLink*, std::vector<double>> weightsPerLink;
+    weightsPerLink.reserve(compatibilities.size());
     // after having estimated the compatibility of all the vertices, you have to
     // run again on all vertices, to compute the weights
     for (auto* pThisVertex : allVertices) {
@@ -177,12 +185,17 @@ AdaptiveMultiVertexFitter::fit(std::vector<xAOD::Vertex*>& allVertices) const
       const auto& theseTrackPointersAtVtx = VTAV(*pThisVertex);
       ATH_MSG_VERBOSE(
         "Beginning lin&update of vertex with pointer: " << pThisVertex);
+      bool relinearized = false;
       for (const auto& pThisTrack : theseTrackPointersAtVtx) {
         // set the weight according to all other track's weight
         ATH_MSG_DEBUG("Calling collect weight for track " << pThisTrack);
-        const std::vector<double>& allweights(
-          collectWeights(*(static_cast<Trk::MVFVxTrackAtVertex*>(pThisTrack))
-                            ->linkToVertices()));
+        Trk::TrackToVtxLink* tracklink =
+          static_cast<Trk::MVFVxTrackAtVertex*>(pThisTrack)->linkToVertices();
+        auto [itWeights, inserted] = weightsPerLink.try_emplace(tracklink);
+        if (inserted) {
+          itWeights->second = collectWeights(*tracklink, compatibilities);
+        }
+        const std::vector<double>& allweights = itWeights->second;
         ATH_MSG_DEBUG("The vtxcompatibility for the track is: "
                       << pThisTrack->vtxCompatibility());
         pThisTrack->setWeight(m_AnnealingMaker->getWeight(
@@ -202,9 +215,7 @@ AdaptiveMultiVertexFitter::fit(std::vector<xAOD::Vertex*>& allVertices) const
             ATH_MSG_VERBOSE("Relinearizing track ");
             m_LinearizedTrackFactory->linearize(*pThisTrack,
                                                 oldpositions[pThisVertex]);
-            MvfFitInfo(*pThisVertex)
-              ->setLinearizationVertex(
-                new Amg::Vector3D(oldpositions[pThisVertex]));
+            relinearized = true;
           }
           // now you can proceed with the update
           ATH_MSG_DEBUG("Update of the track "
@@ -217,6 +228,11 @@ AdaptiveMultiVertexFitter::fit(std::vector<xAOD::Vertex*>& allVertices) const
           m_VertexUpdator->add(*pThisVertex, *pThisTrack);
         }
       } // iterator on tracks
+      if (relinearized) {
+        MvfFitInfo(*pThisVertex)
+          ->setLinearizationVertex(
+            new Amg::Vector3D(oldpositions[pThisVertex]));
+      }
       // show some info about the position
       ATH_MSG_DEBUG("Vertex pointer " << pThisVertex << " New position x: "
                                       << pThisVertex->position().x()
@@ -277,6 +293,57 @@ AdaptiveMultiVertexFitter::fit(std::vector<xAOD::Vertex*>& allVertices) const
   }
 }
 
+AdaptiveMultiVertexFitter::CompatibilityTable
+AdaptiveMultiVertexFitter::collectCompatibilities(
+  const std::vector<xAOD::Vertex*>& allVertices)
+{
+  static const xAOD::Vertex::Accessor<std::vector<Trk::VxTrackAtVertex*>> VTAV(
+    "VTAV");
+  CompatibilityTable table;
+  for (const auto* pThisVertex : allVertices) {
+    for (const auto& pThisTrack : VTAV(*pThisVertex)) {
+      auto& entries =
+        table[static_cast<Trk::MVFVxTrackAtVertex*>(pThisTrack)->linkToVertices()];
+      // as in the single track search, the first track with the link wins
+      auto sameVertex = [pThisVertex](const auto& entry) {
+        return entry.first == pThisVertex;
+      };
+      if (std::none_of(entries.begin(), entries.end(), sameVertex)) {
+        entries.emplace_back(pThisVertex, pThisTrack->vtxCompatibility());
+      }
+    }
+  }
+  return table;
+}
+
+std::vector<double>
+AdaptiveMultiVertexFitter::collectWeights(
+  Trk::TrackToVtxLink& tracklink,
+  const CompatibilityTable& compatibilities) const
+{
+  const auto itLink = compatibilities.find(&tracklink);
+  if (itLink == compatibilities.end()) {
+    return collectWeights(tracklink);
+  }
+  const auto& entries = itLink->second;
+  const auto& theseVertices = *(tracklink.vertices());
+  std::vector<double> myvector;
+  myvector.reserve(theseVertices.size());
+  for (const auto* pThisVertex : theseVertices) {
+    auto sameVertex = [pThisVertex](const auto& entry) {
+      return entry.first == pThisVertex;
+    };
+    const auto itEntry =
+      std::find_if(entries.begin(), entries.end(), sameVertex);
+    if (itEntry == entries.end()) {
+      // vertex not part of this fit: fall back to the full search
+      return collectWeights(tracklink);
+    }
+    myvector.push_back(itEntry->second);
+  }
+  return myvector;
+}
+
 std::vector<double>
 AdaptiveMultiVertexFitter::collectWeights(
   Trk::TrackToVtxLink& tracklink) const
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2002-2021 CERN for the benefit of the ATLAS collaboration
+  Copyright (C) 2002-2024 CERN for the benefit of the ATLAS collaboration
 */
 
 // ********************************************************************
@@ -214,10 +214,16 @@ StatusCode TrigCaloClusterMaker::execute(const EventContext& ctx) const
     
   for (const ToolHandle<CaloClusterProcessor>& clcorr : m_clusterCorrections) {
 
+    // sliding-window corrections are specific to the barrel (3x7) or endcap (5x5) size:
+    // decide once per tool rather than once per cluster
+    const bool is37 = m_isSW && clcorr->name().find("37") != std::string::npos;
+    const bool is55 = m_isSW && clcorr->name().find("55") != std::string::npos;
+    if (m_isSW && !is37 && !is55) continue;
+
     for (xAOD::CaloCluster* cl : *pCaloClusterContainer) {
       if (!m_isSW ||
-          (std::abs(cl->eta0()) < 1.45  && clcorr->name().find("37") != std::string::npos) ||
-          (std::abs(cl->eta0()) >= 1.45 && clcorr->name().find("55") != std::string::npos) ) {
+          (is37 && std::abs(cl->eta0()) < 1.45) ||
+          (is55 && std::abs(cl->eta0()) >= 1.45) ) {
         ATH_CHECK(clcorr->execute(ctx, cl) );
         ATH_MSG_VERBOSE("Executed correction tool " << clcorr->name());
       }
@@ -229,6 +235,12 @@ StatusCode TrigCaloClusterMaker::execute(const EventContext& ctx) const
   SG::WriteDecorHandle<xAOD::CaloClusterContainer, int> mDecor_ncells(m_mDecor_ncells, ctx);
 
   // fill monitored variables
+  const size_t nClusters = pCaloClusterContainer->size();
+  sizeVec.reserve(nClusters);
+  clus_phi.reserve(nClusters);
+  clus_eta.reserve(nClusters);
+  N_BAD_CELLS.reserve(nClusters);
+  ENG_FRAC_MAX.reserve(nClusters);
   for (xAOD::CaloCluster* cl : *pCaloClusterContainer) {
     
     const CaloClusterCellLink* num_cell_links = cl->getCellLinks();